@@ -1,5 +1,9 @@
+#include <cstdlib>
+#include <functional>
 #include <iostream>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 #include "ds/algorithms.hpp"
 #include "utils/FileIO.hpp"
@@ -19,12 +23,15 @@ struct KeywordFrequency {
 int main(int argc, char* argv[]) {
     // 1. Argument Parsing
     if (argc < 3) {
-        std::cout << "Usage: " << argv[0] << " <keyword_file> <data_directory>\n";
+        std::cout << "Usage: " << argv[0] << " <keyword_file> <data_directory> [top_k]\n";
+        std::cout << "       top_k: how many keywords to report (default 20, 0 = all)\n";
         return 1;
     }
 
     std::string keywordFile = argv[1];
     std::string dataDir = argv[2];
+    std::size_t topK = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 20;
+    if (topK == 0) topK = static_cast<std::size_t>(-1);   // 0 = report every keyword
 
     std::cout << "--- Keyword Frequency Analyzer (Functional Paradigm) ---\n\n";
 
@@ -40,34 +47,37 @@ int main(int argc, char* argv[]) {
     ds::LinkedListStorage<std::string> filePaths = utils::FileHandler::listFiles(dataDir);
     std::cout << "    Found " << filePaths.size() << " files.\n";
 
-    // 4. "Scrape all of it": Read ALL words from ALL files
-    // Transformation: List<FilePath> -> List<Word> (FlatMap)
-    std::cout << "[3] Scraping all words from files...\n";
-    auto allWords = ds::flatMap(filePaths, [](const std::string& path) {
-        return utils::FileHandler::readWords(path);
+    // 4. Prepare the keyword table
+    // Only keywords are counted, so memory is O(K) no matter how large the corpus is.
+    // StringHash/equal_to<> let the table be probed with string_views without building strings.
+    ds::HashMapStorage<std::string, std::size_t, ds::StringHash, std::equal_to<>> wordCounts;
+    wordCounts.reserve(keywords.size());
+    ds::forEach(keywords, [&](const std::string& k) { wordCounts.try_emplace(k, 0); });
+
+    // 5. "Scrape all of it": Stream ALL words from ALL files and count them as they pass
+    // Each file is read in fixed-size chunks; every batch of words is counted and dropped
+    // before the next chunk is read, so peak memory is one chunk buffer plus the table.
+    // Each lookup is O(1), so the whole pass is O(N + K) instead of O(K * N).
+    std::cout << "[3] Scanning words and counting keywords...\n";
+    std::size_t totalWords = utils::FileHandler::streamWords(filePaths, [&](std::span<const std::string_view> batch) {
+        ds::forEach(batch, [&](std::string_view word) {
+            auto it = wordCounts.find(word);
+            if (it != wordCounts.end()) ++it->second;
+        });
     });
-    std::cout << "    Total words scanned: " << allWords.size() << "\n";
+    std::cout << "    Total words scanned: " << totalWords << "\n";
 
-    // 5. Count Frequencies for each keyword
-    // This is the "Aggregation" step.
-    // Approach: Map each keyword to a (Word, Count) pair by counting its occurrences in 'allWords'
-    // Note: In a purely functional list-based approach, this is O(K * N), which can be slow for huge datasets.
-    // Ideally, we'd convert 'allWords' to a frequency map/hash first for O(N) + O(K), but let's stick to our lists.
-    
     std::cout << "[4] Calculating frequencies...\n";
     auto frequencies = ds::map(keywords, [&](const std::string& k) {
-        // For each keyword, count how many times it appears in allWords
-        // This inner reduction counts occurrences of 'k'
-        int count = ds::reduce(allWords, 0, [&](int acc, const std::string& word) {
-            return (word == k) ? acc + 1 : acc;
-        });
-        return KeywordFrequency{k, count};
+        return KeywordFrequency{k, static_cast<int>(wordCounts.at(k))};
     });
 
-    // 6. Sort by Frequency (Descending)
+    // 6. Rank by Frequency (Descending)
     // "Decreasing order of their occurence frequencies"
-    std::cout << "[5] Sorting by frequency (descending)...\n";
-    auto sortedFrequencies = ds::sort(frequencies, [](const KeywordFrequency& a, const KeywordFrequency& b) {
+    // Only the reported keywords are ordered: a bounded heap of top_k instead of sorting all K.
+    // Equal counts keep the keyword file's order, exactly like the stable sort did.
+    std::cout << "[5] Ranking by frequency (descending)...\n";
+    auto sortedFrequencies = ds::topK(frequencies, topK, [](const KeywordFrequency& a, const KeywordFrequency& b) {
         return a.count > b.count; // Descending order
     });
 
@@ -0,0 +1,127 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+// Keeps the optimizer from discarding a computed value.
+template <typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * Runs f() `reps` times after one warmup call and returns the best wall time in milliseconds.
+ */
+template <typename F>
+double bestOfMs(F&& f, int reps = 5) {
+    f();
+    double best = 1e300;
+    for (int r = 0; r < reps; ++r) {
+        auto t0 = std::chrono::steady_clock::now();
+        f();
+        auto t1 = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::milli>(t1 - t0).count());
+    }
+    return best;
+}
+
+inline void report(const std::string& label, std::size_t ops, double ms) {
+    std::cout << std::left << std::setw(48) << label
+              << std::right << std::setw(10) << std::fixed << std::setprecision(3) << ms << " ms"
+              << std::setw(10) << std::setprecision(1) << (ops / ms / 1e3) << " Mops/s\n";
+}
+
+// Throughput in bytes per second, for scanning/parsing kernels.
+inline void reportBytes(const std::string& label, std::size_t bytes, double ms) {
+    std::cout << std::left << std::setw(48) << label
+              << std::right << std::setw(10) << std::fixed << std::setprecision(3) << ms << " ms"
+              << std::setw(10) << std::setprecision(1) << (bytes / ms / 1e6) << " GB/s\n";
+}
+
+/**
+ * Timing distribution of one measurement: f() runs `warmup` times untimed, then `reps` times.
+ * p99 is nearest-rank, so with fewer than 100 repetitions it is the slowest run.
+ */
+struct Stats {
+    double minMs = 0;
+    double medianMs = 0;
+    double p99Ms = 0;
+    double maxMs = 0;
+    int warmup = 0;
+    int reps = 0;
+};
+
+template <typename F>
+Stats sampleMs(F&& f, int warmup = 1, int reps = 11) {
+    for (int w = 0; w < warmup; ++w) f();
+    std::vector<double> times;
+    times.reserve(static_cast<std::size_t>(reps));
+    for (int r = 0; r < reps; ++r) {
+        auto t0 = std::chrono::steady_clock::now();
+        f();
+        auto t1 = std::chrono::steady_clock::now();
+        times.push_back(std::chrono::duration<double, std::milli>(t1 - t0).count());
+    }
+    std::sort(times.begin(), times.end());
+    Stats st;
+    st.warmup = warmup;
+    st.reps = reps;
+    if (times.empty()) return st;
+    std::size_t n = times.size();
+    st.minMs = times.front();
+    st.maxMs = times.back();
+    st.medianMs = n % 2 ? times[n / 2] : (times[n / 2 - 1] + times[n / 2]) / 2;
+    st.p99Ms = times[(99 * n + 99) / 100 - 1];
+    return st;
+}
+
+// One measured row of a machine-readable report.
+struct Result {
+    std::string group;      // "container" or "algorithm"
+    std::string subject;    // e.g. "Stack", "sort"
+    std::string variant;    // storage backend or input container
+    std::string type;       // element type
+    std::string op;
+    std::size_t n = 0;      // elements
+    std::size_t ops = 0;    // operations timed per repetition
+    Stats stats;
+};
+
+inline std::string jsonString(const std::string& s) {
+    std::string out = "\"";
+    for (char c : s) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out + "\"";
+}
+
+/**
+ * Writes {"build": ..., "results": [...]} with one object per Result; times are in ms,
+ * throughput in operations per second derived from the median.
+ */
+inline void writeJson(std::ostream& os, const std::string& build, const std::vector<Result>& results) {
+    os << "{\n  \"build\": " << jsonString(build) << ",\n  \"results\": [";
+    os << std::setprecision(6) << std::defaultfloat;
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        os << (i ? ",\n" : "\n") << "    {\"group\": " << jsonString(r.group)
+           << ", \"subject\": " << jsonString(r.subject) << ", \"variant\": " << jsonString(r.variant)
+           << ", \"type\": " << jsonString(r.type) << ", \"op\": " << jsonString(r.op)
+           << ", \"n\": " << r.n << ", \"ops\": " << r.ops
+           << ", \"warmup\": " << r.stats.warmup << ", \"reps\": " << r.stats.reps
+           << ", \"min_ms\": " << r.stats.minMs << ", \"median_ms\": " << r.stats.medianMs
+           << ", \"p99_ms\": " << r.stats.p99Ms << ", \"max_ms\": " << r.stats.maxMs
+           << ", \"ops_per_sec\": " << (r.stats.medianMs > 0 ? r.ops / r.stats.medianMs * 1e3 : 0.0) << "}";
+    }
+    os << "\n  ]\n}\n";
+}
+
+} // namespace bench
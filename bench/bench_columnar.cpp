@@ -0,0 +1,120 @@
+// Integer pipelines: the fused LinkedListStorage pass vs. ds::columnar kernels (scalar and AVX2).
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "bench/bench.hpp"
+#include "ds/columnar/Kernels.hpp"
+#include "ds/storage/LinkedListStorage.hpp"
+
+namespace col = ds::columnar;
+
+// Like bench::bestOfMs, but setup() runs untimed before every repetition (filters consume their input).
+template <typename Setup, typename F>
+static double bestOfMsWithSetup(Setup&& setup, F&& f, int reps = 5) {
+    double best = 1e300;
+    for (int r = 0; r <= reps; ++r) {
+        setup();
+        auto t0 = std::chrono::steady_clock::now();
+        f();
+        auto t1 = std::chrono::steady_clock::now();
+        if (r > 0) best = std::min(best, std::chrono::duration<double, std::milli>(t1 - t0).count());
+    }
+    return best;
+}
+
+int main() {
+    const std::size_t n = 10'000'000;
+    std::mt19937_64 rng(16);
+    std::vector<std::int32_t> values(n);
+    for (auto& v : values) v = static_cast<std::int32_t>(rng() % 2001) - 1000;
+
+    ds::LinkedListStorage<int> list;
+    col::Column<std::int32_t> column;
+    auto resetList = [&] { list = ds::LinkedListStorage<int>{}; for (int v : values) list.push_back(v); };
+    auto resetColumn = [&] { column.assign(values.begin(), values.end()); };
+    resetList();
+    resetColumn();
+
+    std::cout << "--- " << n << " int32 values, AVX2 " << (col::bestIsa() == col::Isa::AVX2 ? "on" : "off") << " ---\n";
+
+    // First, while the heap is unfragmented: the whole line `load | filter > 0 | map * 3 | map + 1 | sum`, starting from the parsed buffer:
+    // the list backend builds only the survivors as nodes, the column backend copies and runs kernels.
+    bench::report("pipeline: list, fused single pass", n, bench::bestOfMs([&] {
+        ds::LinkedListStorage<int> out;
+        long long s = 0;
+        for (int x : values) {
+            if (!(x > 0)) continue;
+            x = x * 3 + 1;
+            s += x;
+            out.push_back(x);
+        }
+        bench::doNotOptimize(s);
+    }, 3));
+    bench::report("pipeline: column, one kernel per stage", n, bench::bestOfMs([&] {
+        column.assign(values.begin(), values.end());
+        col::filter(column, col::Compare::Greater, 0);
+        col::affine(column, 3, 0);
+        col::affine(column, 1, 1);
+        bench::doNotOptimize(col::sum(column));
+    }));
+
+    // Terminals, then maps, on the freshly built list (node order still matches allocation order).
+    bench::report("sum: list", n, bench::bestOfMs([&] {
+        long long s = 0;
+        for (int x : list) s += x;
+        bench::doNotOptimize(s);
+    }, 3));
+    bench::report("min + max: list", n, bench::bestOfMs([&] {
+        int lo = list.front(), hi = list.front();
+        for (int x : list) { lo = std::min(lo, x); hi = std::max(hi, x); }
+        bench::doNotOptimize(lo + hi);
+    }, 3));
+    bench::report("count > 0: list", n, bench::bestOfMs([&] {
+        std::size_t c = 0;
+        for (int x : list) c += x > 0;
+        bench::doNotOptimize(c);
+    }, 3));
+    for (col::Isa isa : {col::Isa::Scalar, col::Isa::AVX2}) {
+        if (isa == col::Isa::AVX2 && col::bestIsa() != col::Isa::AVX2) continue;
+        std::string tag = isa == col::Isa::AVX2 ? "AVX2" : "scalar";
+        bench::report("sum: column " + tag, n, bench::bestOfMs([&] { bench::doNotOptimize(col::sum(column, isa)); }));
+        bench::report("min + max: column " + tag, n, bench::bestOfMs([&] {
+            bench::doNotOptimize(*col::min(column, isa) + *col::max(column, isa));
+        }));
+        bench::report("count > 0: column " + tag, n, bench::bestOfMs([&] {
+            bench::doNotOptimize(col::count(column, col::Compare::Greater, 0, isa));
+        }));
+    }
+
+    // map * 3 | map + 1 (values wrap; repeating it is harmless)
+    bench::report("map * 3 + 1: list forEach", n, bench::bestOfMs([&] {
+        for (int& x : list) x = static_cast<int>(static_cast<unsigned>(x) * 3u + 1u);
+        bench::doNotOptimize(list.size());
+    }, 3));
+    for (col::Isa isa : {col::Isa::Scalar, col::Isa::AVX2}) {
+        if (isa == col::Isa::AVX2 && col::bestIsa() != col::Isa::AVX2) continue;
+        bench::report(std::string("map * 3 + 1: column ") + (isa == col::Isa::AVX2 ? "AVX2" : "scalar"), n,
+                      bench::bestOfMs([&] {
+                          col::affine(column, 3, 1, isa);
+                          bench::doNotOptimize(column.data()[0]);
+                      }));
+    }
+
+    // Filters consume their input and leave the heap fragmented, so they run last.
+    // filter > 0 (about half survive)
+    bench::report("filter > 0: list remove_if", n, bestOfMsWithSetup(resetList, [&] {
+        list.remove_if([](int& x) { return !(x > 0); });
+        bench::doNotOptimize(list.size());
+    }, 3));
+    for (col::Isa isa : {col::Isa::Scalar, col::Isa::AVX2}) {
+        if (isa == col::Isa::AVX2 && col::bestIsa() != col::Isa::AVX2) continue;
+        bench::report(std::string("filter > 0: column ") + (isa == col::Isa::AVX2 ? "AVX2" : "scalar"), n,
+                      bestOfMsWithSetup(resetColumn, [&] {
+                          col::filter(column, col::Compare::Greater, 0, isa);
+                          bench::doNotOptimize(column.size());
+                      }));
+    }
+
+    return 0;
+}
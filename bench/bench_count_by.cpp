@@ -0,0 +1,59 @@
+// Keyword frequency: per-keyword reduce (O(K*N)) vs. one countBy pass plus K lookups (O(N + K)).
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "bench/bench.hpp"
+#include "ds/algorithms.hpp"
+
+static std::string randomWord(std::mt19937& rng) {
+    std::string w(3 + rng() % 8, 'a');
+    for (auto& c : w) c = static_cast<char>('a' + rng() % 26);
+    return w;
+}
+
+int main() {
+    const std::size_t n = 1'000'000;
+    const std::size_t vocabulary = 200'000;
+    std::mt19937 rng(7);
+    std::vector<std::string> vocab(vocabulary);
+    for (auto& w : vocab) w = randomWord(rng);
+    ds::LinkedListStorage<std::string> words;
+    for (std::size_t i = 0; i < n; ++i) words.push_back(vocab[rng() % vocabulary]);
+
+    std::cout << "--- Keyword frequencies over N = " << n << " words (vocabulary " << vocabulary << ") ---\n";
+    for (std::size_t k : {10, 1'000, 100'000}) {
+        ds::LinkedListStorage<std::string> keywords;
+        for (std::size_t i = 0; i < k; ++i) keywords.push_back(vocab[rng() % vocabulary]);
+        std::string tag = "K=" + std::to_string(k) + " ";
+
+        if (k * n <= 1'000'000'000) {
+            bench::report(tag + "reduce per keyword", k * n, bench::bestOfMs([&] {
+                auto freq = ds::map(keywords, [&](const std::string& kw) {
+                    return ds::reduce(words, 0, [&](int acc, const std::string& w) { return w == kw ? acc + 1 : acc; });
+                });
+                bench::doNotOptimize(freq.size());
+            }, 1));
+        } else {
+            std::cout << std::left << std::setw(48) << (tag + "reduce per keyword") << "   skipped (K*N too large)\n";
+        }
+        bench::report(tag + "countBy + lookups", n + k, bench::bestOfMs([&] {
+            auto counts = ds::countBy(words);
+            auto freq = ds::map(keywords, [&](const std::string& kw) {
+                auto it = counts.find(kw);
+                return it == counts.end() ? std::size_t{0} : it->second;
+            });
+            bench::doNotOptimize(freq.size());
+        }, 3));
+        bench::report(tag + "std::unordered_map + lookups", n + k, bench::bestOfMs([&] {
+            std::unordered_map<std::string, std::size_t> counts;
+            for (const auto& w : words) ++counts[w];
+            auto freq = ds::map(keywords, [&](const std::string& kw) {
+                auto it = counts.find(kw);
+                return it == counts.end() ? std::size_t{0} : it->second;
+            });
+            bench::doNotOptimize(freq.size());
+        }, 3));
+    }
+    return 0;
+}
@@ -0,0 +1,117 @@
+// Dijkstra on random graphs: PriorityQueue with lazy deletion (push duplicates, skip stale pops)
+// vs. AddressablePriorityQueue with one entry per vertex and update() as decrease-key.
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "bench/bench.hpp"
+#include "ds/containers/AddressablePriorityQueue.hpp"
+#include "ds/containers/PriorityQueue.hpp"
+
+using Dist = std::uint64_t;
+using Item = std::pair<Dist, std::uint32_t>;   // (distance, vertex); std::greater puts the nearest on top
+constexpr Dist kInf = ~Dist{0};
+
+// Compressed adjacency: the edges of v are targets/weights[first[v] .. first[v + 1]).
+struct Graph {
+    std::vector<std::uint32_t> first, target, weight;
+    std::size_t vertices() const { return first.size() - 1; }
+};
+
+Graph randomGraph(std::size_t n, std::size_t degree, std::uint32_t maxWeight, unsigned seed) {
+    std::mt19937 rng(seed);
+    Graph g;
+    g.first.resize(n + 1);
+    for (std::size_t v = 0; v <= n; ++v) g.first[v] = static_cast<std::uint32_t>(v * degree);
+    g.target.resize(n * degree);
+    g.weight.resize(n * degree);
+    for (std::size_t e = 0; e < n * degree; ++e) {
+        g.target[e] = static_cast<std::uint32_t>(rng() % n);
+        g.weight[e] = 1 + static_cast<std::uint32_t>(rng() % maxWeight);
+    }
+    return g;
+}
+
+struct Stats {
+    std::size_t pushes = 0, peak = 0, stale = 0;
+};
+
+std::vector<Dist> lazyDijkstra(const Graph& g, Stats& st) {
+    std::vector<Dist> dist(g.vertices(), kInf);
+    ds::PriorityQueue<Item, std::greater<Item>> pq;
+    dist[0] = 0;
+    pq.push({0, 0});
+    st = {1, 1, 0};
+    while (!pq.empty()) {
+        auto [d, v] = pq.top();
+        pq.pop();
+        if (d > dist[v]) { ++st.stale; continue; }
+        for (std::uint32_t e = g.first[v]; e < g.first[v + 1]; ++e) {
+            Dist nd = d + g.weight[e];
+            std::uint32_t u = g.target[e];
+            if (nd < dist[u]) {
+                dist[u] = nd;
+                pq.push({nd, u});
+                ++st.pushes;
+                st.peak = std::max(st.peak, pq.size());
+            }
+        }
+    }
+    return dist;
+}
+
+std::vector<Dist> addressableDijkstra(const Graph& g, Stats& st) {
+    using PQ = ds::AddressablePriorityQueue<Item, std::greater<Item>>;
+    std::vector<Dist> dist(g.vertices(), kInf);
+    std::vector<PQ::handle_type> handle(g.vertices());
+    PQ pq;
+    dist[0] = 0;
+    handle[0] = pq.insert({0, 0});
+    st = {1, 1, 0};
+    while (!pq.empty()) {
+        auto [d, v] = pq.top();
+        pq.pop();
+        for (std::uint32_t e = g.first[v]; e < g.first[v + 1]; ++e) {
+            Dist nd = d + g.weight[e];
+            std::uint32_t u = g.target[e];
+            if (nd < dist[u]) {
+                dist[u] = nd;
+                // A popped vertex's handle is stale, so contains() doubles as the "still queued" test.
+                if (pq.contains(handle[u])) {
+                    pq.update(handle[u], {nd, u});
+                } else {
+                    handle[u] = pq.insert({nd, u});
+                    ++st.pushes;
+                    st.peak = std::max(st.peak, pq.size());
+                }
+            }
+        }
+    }
+    return dist;
+}
+
+int main() {
+    struct Case { std::size_t n, degree; std::uint32_t maxWeight; };
+    for (Case c : {Case{1'000'000, 4, 100}, Case{200'000, 32, 100}, Case{200'000, 32, 1'000'000}}) {
+        Graph g = randomGraph(c.n, c.degree, c.maxWeight, 21);
+        std::size_t edges = c.n * c.degree;
+        std::cout << "--- V = " << c.n << ", E = " << edges << ", weights 1.." << c.maxWeight << " ---\n";
+
+        Stats lazy, addressable;
+        bool same = lazyDijkstra(g, lazy) == addressableDijkstra(g, addressable);
+        bench::report("lazy deletion (PriorityQueue)", edges, bench::bestOfMs([&] {
+            Stats st;
+            bench::doNotOptimize(lazyDijkstra(g, st).back());
+        }, 3));
+        bench::report("decrease-key (AddressablePriorityQueue)", edges, bench::bestOfMs([&] {
+            Stats st;
+            bench::doNotOptimize(addressableDijkstra(g, st).back());
+        }, 3));
+        std::cout << "  pushes " << lazy.pushes << " vs " << addressable.pushes << ", peak size " << lazy.peak
+                  << " vs " << addressable.peak << ", stale pops " << lazy.stale
+                  << (same ? "" : "  (DISTANCES DIFFER)") << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,65 @@
+// PriorityQueue loading (N pushes vs. one heapify) and binary VectorHeapStorage vs. DAryHeapStorage<D>.
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+#include "bench/bench.hpp"
+#include "ds/containers/PriorityQueue.hpp"
+#include "ds/storage/DAryHeapStorage.hpp"
+#include "ds/storage/VectorHeapStorage.hpp"
+
+template <typename S>
+using PQ = ds::PriorityQueue<int, std::less<int>, S>;
+
+template <typename S>
+void runHeap(const std::string& name, const std::vector<int>& values) {
+    std::size_t n = values.size();
+    bench::report(name + " load: range ctor (heapify)", n, bench::bestOfMs([&] {
+        PQ<S> pq(values.begin(), values.end());
+        bench::doNotOptimize(pq.top());
+    }, 3));
+
+    PQ<S> full(values.begin(), values.end());
+    bench::report(name + " drain: pop all", n, bench::bestOfMs([&] {
+        PQ<S> pq = full;
+        while (!pq.empty()) pq.pop();
+        bench::doNotOptimize(pq.size());
+    }, 3));
+
+    // Steady state: a full heap where every step removes the top and inserts a new value.
+    bench::report(name + " steady: pop + push", 2 * n, bench::bestOfMs([&] {
+        PQ<S> pq = full;
+        unsigned x = 12345;
+        for (std::size_t i = 0; i < n; ++i) {
+            pq.pop();
+            x = x * 1664525u + 1013904223u;
+            pq.push(static_cast<int>(x >> 1));
+        }
+        bench::doNotOptimize(pq.top());
+    }, 3));
+}
+
+int main() {
+    using Binary = ds::VectorHeapStorage<int, std::less<int>>;
+    for (std::size_t n : {1'000'000, 10'000'000}) {
+        std::mt19937 rng(19);
+        std::vector<int> values(n);
+        for (auto& v : values) v = static_cast<int>(rng() >> 1);
+        std::cout << "--- N = " << n << " ---\n";
+
+        bench::report("VectorHeap load: push x N", n, bench::bestOfMs([&] {
+            PQ<Binary> pq;
+            for (int v : values) pq.push(v);
+            bench::doNotOptimize(pq.top());
+        }, 3));
+        bench::report("VectorHeap load: push_range", n, bench::bestOfMs([&] {
+            PQ<Binary> pq;
+            pq.push_range(values.begin(), values.end());
+            bench::doNotOptimize(pq.top());
+        }, 3));
+        runHeap<Binary>("VectorHeap (D=2)", values);
+        runHeap<ds::DAryHeapStorage<int, std::less<int>, 4>>("DAryHeap<4>", values);
+        runHeap<ds::DAryHeapStorage<int, std::less<int>, 8>>("DAryHeap<8>", values);
+    }
+    return 0;
+}
@@ -0,0 +1,103 @@
+// Containers used through their interfaces (IStack / IQueue / IDeque / IPriorityQueue&): one
+// virtual push / pop per element vs. push_range + pop_n in 256-element batches, and draining
+// into a second container element by element vs. drain_into.
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+#include "bench/bench.hpp"
+#include "ds/containers/Deque.hpp"
+#include "ds/containers/PriorityQueue.hpp"
+#include "ds/containers/Queue.hpp"
+#include "ds/containers/Stack.hpp"
+#include "ds/storage/RingBufferStorage.hpp"
+
+constexpr std::size_t kN = 1'000'000;
+constexpr std::size_t kBatch = 256;
+
+// Hides the dynamic type from the optimizer, so every call really goes through the vtable.
+template <typename I>
+I& opaque(I& c) {
+    I* volatile p = &c;
+    return *p;
+}
+
+// push(c, x) / take(c) are the per-element interface calls (take returns the front or top and pops it).
+template <typename I, typename Push, typename Take>
+void compare(const std::string& name, I& c, I& sink, const std::vector<int>& values, Push push, Take take) {
+    std::cout << "--- " << name << ", " << kN << " ints ---\n";
+    std::uint64_t sum = 0;
+    bench::report("push + pop, per element", 2 * kN, bench::bestOfMs([&] {
+        for (int v : values) push(c, v);
+        for (std::size_t i = 0; i < kN; ++i) sum += static_cast<unsigned>(take(c));
+    }, 3));
+    bench::report("push_range + pop_n x" + std::to_string(kBatch), 2 * kN, bench::bestOfMs([&] {
+        std::span<const int> all(values);
+        for (std::size_t i = 0; i < kN; i += kBatch) c.push_range(all.subspan(i, std::min(kBatch, kN - i)));
+        int buf[kBatch];
+        while (std::size_t k = c.pop_n(buf, kBatch)) {
+            for (std::size_t j = 0; j < k; ++j) sum += static_cast<unsigned>(buf[j]);
+        }
+    }, 3));
+
+    // Drains time only the transfer; both containers are refilled / emptied between runs.
+    auto drainMs = [&](auto drain) {
+        double best = 1e300;
+        for (int r = 0; r < 3; ++r) {
+            c.push_range(values);
+            auto t0 = std::chrono::steady_clock::now();
+            drain();
+            best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count());
+            int buf[kBatch];
+            while (std::size_t k = sink.pop_n(buf, kBatch)) sum += k;
+        }
+        return best;
+    };
+    bench::report("drain, per element", kN, drainMs([&] { while (!c.empty()) push(sink, take(c)); }));
+    bench::report("drain_into", kN, drainMs([&] { c.drain_into(sink); }));
+    bench::doNotOptimize(sum);
+}
+
+int main() {
+    std::mt19937 rng(25);
+    std::vector<int> values(kN);
+    for (auto& v : values) v = static_cast<int>(rng() >> 1);
+
+    auto stackPush = [](ds::IStack<int>& s, int x) { s.push(x); };
+    auto stackTake = [](ds::IStack<int>& s) { int x = s.top(); s.pop(); return x; };
+    auto queuePush = [](ds::IQueue<int>& q, int x) { q.enqueue(x); };
+    auto queueTake = [](ds::IQueue<int>& q) { int x = q.front(); q.dequeue(); return x; };
+    {
+        ds::Stack<int> a, b;
+        compare("Stack<LinkedListStorage>", opaque<ds::IStack<int>>(a), opaque<ds::IStack<int>>(b), values, stackPush, stackTake);
+    }
+    {
+        ds::Stack<int, ds::RingBufferStorage<int>> a, b;
+        compare("Stack<RingBufferStorage>", opaque<ds::IStack<int>>(a), opaque<ds::IStack<int>>(b), values, stackPush, stackTake);
+    }
+    {
+        ds::Queue<int> a, b;
+        compare("Queue<LinkedListStorage>", opaque<ds::IQueue<int>>(a), opaque<ds::IQueue<int>>(b), values, queuePush, queueTake);
+    }
+    {
+        ds::Queue<int, ds::RingBufferStorage<int>> a, b;
+        compare("Queue<RingBufferStorage>", opaque<ds::IQueue<int>>(a), opaque<ds::IQueue<int>>(b), values, queuePush, queueTake);
+    }
+    {
+        ds::Deque<int> a, b;
+        compare("Deque<LinkedListStorage>", opaque<ds::IDeque<int>>(a), opaque<ds::IDeque<int>>(b), values,
+            [](ds::IDeque<int>& d, int x) { d.push_back(x); },
+            [](ds::IDeque<int>& d) { int x = d.front(); d.pop_front(); return x; });
+    }
+    {
+        using IPQ = ds::IPriorityQueue<int, std::less<int>>;
+        ds::PriorityQueue<int> a, b;
+        compare("PriorityQueue<VectorHeapStorage>", opaque<IPQ>(a), opaque<IPQ>(b), values,
+            [](IPQ& pq, int x) { pq.push(x); },
+            [](IPQ& pq) { int x = pq.top(); pq.pop(); return x; });
+    }
+    return 0;
+}
@@ -0,0 +1,138 @@
+// Shared priority queue under threads: a mutex around ds::PriorityQueue vs. ds::MultiQueue with
+// 2 and 4 shards per thread. Throughput on a pre-filled queue with a 50/50 push/pop mix, then
+// the MultiQueue's rank error (how many better elements were still queued at each pop) while
+// the threads drain it.
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "bench/bench.hpp"
+#include "ds/containers/MultiQueue.hpp"
+#include "ds/containers/PriorityQueue.hpp"
+
+constexpr std::size_t kPrefill = 1'000'000;
+constexpr std::size_t kOpsPerThread = 1'000'000;
+
+// Runs body(t) on `threads` threads at once and returns the wall time in ms.
+template <typename Body>
+double timeThreads(std::size_t threads, Body body) {
+    std::vector<std::thread> pool;
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t t = 0; t < threads; ++t) pool.emplace_back([&, t] { body(t); });
+    for (auto& th : pool) th.join();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Each thread alternates push(random key) and pop.
+template <typename Push, typename Pop>
+double mixedOps(std::size_t threads, Push push, Pop pop) {
+    return timeThreads(threads, [&](std::size_t t) {
+        std::uint64_t x = 0x2545F4914F6CDD1Dull * (t + 1);
+        for (std::size_t i = 0; i < kOpsPerThread / 2; ++i) {
+            x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+            push(x >> 1);
+            pop();
+        }
+    });
+}
+
+struct RankError {
+    double mean = 0;
+    std::size_t p99 = 0, max = 0;
+};
+
+// The keys 0..n-1 are queued; pops[i] is the i-th key taken. With std::less the best key is the
+// largest, so a pop's rank error is the number of larger keys still queued at that moment.
+RankError rankErrors(const std::vector<std::uint32_t>& pops, std::size_t n) {
+    std::vector<std::uint32_t> tree(n + 1, 0);   // Fenwick tree over queued keys
+    for (std::size_t i = 1; i <= n; ++i) {
+        tree[i] += 1;
+        if (std::size_t parent = i + (i & (0 - i)); parent <= n) tree[parent] += tree[i];
+    }
+    auto queuedUpTo = [&](std::size_t k) {   // queued keys in [0, k]
+        std::size_t s = 0;
+        for (std::size_t i = k + 1; i > 0; i -= i & (0 - i)) s += tree[i];
+        return s;
+    };
+    std::vector<std::size_t> errors;
+    errors.reserve(pops.size());
+    std::size_t queued = n;
+    for (std::uint32_t key : pops) {
+        errors.push_back(queued - queuedUpTo(key));
+        for (std::size_t i = key + 1; i <= n; i += i & (0 - i)) tree[i] -= 1;
+        --queued;
+    }
+    RankError r;
+    r.mean = std::accumulate(errors.begin(), errors.end(), 0.0) / static_cast<double>(std::max<std::size_t>(errors.size(), 1));
+    std::sort(errors.begin(), errors.end());
+    if (!errors.empty()) {
+        r.p99 = errors[(errors.size() * 99) / 100];
+        r.max = errors.back();
+    }
+    return r;
+}
+
+int main(int argc, char** argv) {
+    std::size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::string_view(argv[i]) == "--max-threads") maxThreads = std::strtoull(argv[++i], nullptr, 10);
+    }
+    std::vector<std::size_t> threadCounts;
+    for (std::size_t t = 1; t < maxThreads; t *= 2) threadCounts.push_back(t);
+    threadCounts.push_back(maxThreads);
+
+    std::mt19937_64 rng(24);
+    std::vector<std::uint64_t> prefill(kPrefill);
+    for (auto& v : prefill) v = rng() >> 1;
+
+    for (std::size_t threads : threadCounts) {
+        std::size_t ops = threads * kOpsPerThread;
+        std::cout << "--- " << threads << " threads, " << kPrefill << " queued, push/pop mix ---\n";
+        {
+            ds::PriorityQueue<std::uint64_t> pq(prefill.begin(), prefill.end());
+            std::mutex m;
+            bench::report("mutex + ds::PriorityQueue", ops, mixedOps(threads,
+                [&](std::uint64_t x) { std::lock_guard<std::mutex> lk(m); pq.push(x); },
+                [&] { std::lock_guard<std::mutex> lk(m); pq.pop(); }));
+        }
+        for (std::size_t factor : {2, 4}) {
+            ds::MultiQueue<std::uint64_t> mq(threads, factor);
+            for (auto v : prefill) mq.push(v);
+            bench::report("MultiQueue x" + std::to_string(factor) + " (" + std::to_string(mq.shards()) + " shards)", ops,
+                mixedOps(threads, [&](std::uint64_t x) { mq.push(x); }, [&] { std::uint64_t y = 0; mq.try_pop(y); bench::doNotOptimize(y); }));
+        }
+    }
+
+    // Rank error while `threads` threads drain a queue holding the keys 0..n-1.
+    const std::size_t n = 1'000'000;
+    std::vector<std::uint32_t> keys(n);
+    std::iota(keys.begin(), keys.end(), 0u);
+    std::shuffle(keys.begin(), keys.end(), rng);
+    std::cout << "--- MultiQueue rank error while draining " << n << " keys (0 = exact) ---\n";
+    for (std::size_t threads : threadCounts) {
+        for (std::size_t factor : {1, 2, 4}) {
+            ds::MultiQueue<std::uint32_t> mq(threads, factor);
+            for (auto k : keys) mq.push(k);
+            std::vector<std::uint32_t> pops(n);
+            std::atomic<std::size_t> next{0};
+            // The order is stamped while the shard is locked, so a thread that is descheduled right
+            // after its pop cannot make later pops look like rank errors.
+            timeThreads(threads, [&](std::size_t) {
+                std::uint32_t k;
+                while (mq.try_pop(k, [&](std::uint32_t key) { pops[next.fetch_add(1, std::memory_order_relaxed)] = key; })) {}
+            });
+            RankError r = rankErrors(pops, n);
+            std::cout << "  threads " << threads << ", x" << factor << " (" << mq.shards() << " shards): mean " << r.mean
+                      << ", p99 " << r.p99 << ", max " << r.max << "\n";
+        }
+    }
+    return 0;
+}
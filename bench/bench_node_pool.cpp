@@ -0,0 +1,39 @@
+// Per-node new/delete vs. slab-pooled nodes for LinkedListStorage.
+#include <string>
+#include "bench/bench.hpp"
+#include "ds/storage/LinkedListStorage.hpp"
+
+template <typename List>
+void run(const std::string& name, std::size_t n) {
+    using T = typename List::value_type;
+
+    bench::report(name + " push_back+clear", n, bench::bestOfMs([&] {
+        List l;
+        for (std::size_t i = 0; i < n; ++i) l.push_back(static_cast<T>(i));
+        bench::doNotOptimize(l.size());
+    }));
+
+    bench::report(name + " queue churn (push/pop)", n, bench::bestOfMs([&] {
+        List l;
+        for (std::size_t i = 0; i < 64; ++i) l.push_back(static_cast<T>(i));
+        for (std::size_t i = 0; i < n; ++i) { l.push_back(static_cast<T>(i)); l.pop_front(); }
+        bench::doNotOptimize(l.front());
+    }));
+
+    List src;
+    for (std::size_t i = 0; i < n; ++i) src.push_back(static_cast<T>(i));
+    bench::report(name + " copy", n, bench::bestOfMs([&] {
+        List copy(src);
+        bench::doNotOptimize(copy.size());
+    }));
+}
+
+int main() {
+    const std::size_t n = 1'000'000;
+    std::cout << "--- LinkedListStorage node allocation (N = " << n << ") ---\n";
+    run<ds::LinkedListStorage<int>>("new/delete  <int>", n);
+    run<ds::PooledLinkedListStorage<int>>("slab pool   <int>", n);
+    run<ds::LinkedListStorage<long long>>("new/delete  <long long>", n);
+    run<ds::PooledLinkedListStorage<long long>>("slab pool   <long long>", n);
+    return 0;
+}
@@ -0,0 +1,68 @@
+// Scaling of the parallel map/filter/reduce/forEach/sort overloads at 1..16 threads.
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+#include "bench/bench.hpp"
+#include "ds/algorithms.hpp"
+
+// The par reduce overloads must agree with the serial fold, whatever the chunking.
+template <typename Container>
+bool reduceMatches(const Container& data, std::size_t threads) {
+    ds::ThreadPool pool(threads);
+    auto pol = ds::par.on(pool);
+    auto maxOp = [](int a, int b) { return std::max(a, b); };
+    auto sumOp = [](long long a, int x) { return a + x; };
+    auto countOp = [](long long a, int x) { return a + (x % 3 == 0); };
+    bool ok = ds::reduce(pol, data, 0, maxOp) == ds::reduce(data, 0, maxOp) &&
+              ds::reduce(pol, data, 0LL, sumOp, std::plus<>{}) == ds::reduce(data, 0LL, sumOp) &&
+              ds::reduce(pol, data, 0LL, countOp, std::plus<>{}) == ds::reduce(data, 0LL, countOp);
+    if (!ok) std::cerr << "par reduce differs from the serial fold at t=" << threads << "\n";
+    return ok;
+}
+
+template <typename Container>
+void run(const std::string& name, const Container& data, std::size_t threads) {
+    ds::ThreadPool pool(threads);
+    auto pol = ds::par.on(pool);
+    std::size_t n = data.size();
+    std::string tag = name + " t=" + std::to_string(threads) + " ";
+
+    bench::report(tag + "map", n, bench::bestOfMs([&] {
+        bench::doNotOptimize(ds::map(pol, data, [](int x) { return x * 3 + 1; }).size());
+    }, 3));
+    bench::report(tag + "filter", n, bench::bestOfMs([&] {
+        bench::doNotOptimize(ds::filter(pol, data, [](int x) { return x % 3 == 0; }).size());
+    }, 3));
+    bench::report(tag + "reduce", n, bench::bestOfMs([&] {
+        bench::doNotOptimize(ds::reduce(pol, data, 0LL, [](long long a, int x) { return a + x; }, std::plus<>{}));
+    }, 3));
+    bench::report(tag + "forEach", n, bench::bestOfMs([&] {
+        std::atomic<long long> hits{0};
+        ds::forEach(pol, data, [&](int x) { if ((x & 1023) == 0) hits.fetch_add(1, std::memory_order_relaxed); });
+        bench::doNotOptimize(hits.load());
+    }, 3));
+    bench::report(tag + "sort", n, bench::bestOfMs([&] {
+        bench::doNotOptimize(ds::sort(pol, data).size());
+    }, 3));
+}
+
+int main() {
+    const std::size_t n = 1'000'000;
+    std::mt19937 rng(42);
+    std::vector<int> vec(n);
+    for (auto& x : vec) x = static_cast<int>(rng() % 1'000'000);
+    ds::LinkedListStorage<int> list;
+    for (int x : vec) list.push_back(x);
+
+    std::cout << "--- Parallel algorithm scaling (N = " << n << ", hardware threads = "
+              << std::thread::hardware_concurrency() << ") ---\n";
+    for (std::size_t threads : {1, 2, 4, 8, 16}) {
+        if (!reduceMatches(vec, threads) || !reduceMatches(list, threads)) return 1;
+    }
+    for (std::size_t threads : {1, 2, 4, 8, 16}) run("vector<int>", vec, threads);
+    for (std::size_t threads : {1, 2, 4, 8, 16}) run("LinkedList<int>", list, threads);
+    return 0;
+}
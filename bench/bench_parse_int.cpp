@@ -0,0 +1,56 @@
+// Numeric loading: std::stoi + try/catch (the old load path) vs. std::from_chars vs. utils::parseInteger.
+#include <charconv>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+#include "bench/bench.hpp"
+#include "utils/NumberParser.hpp"
+#include "utils/Tokenizer.hpp"
+
+static std::string makeText(std::size_t count, int malformedPercent, std::mt19937_64& rng) {
+    std::string text;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (static_cast<int>(rng() % 100) < malformedPercent) text += "n/a";
+        else text += std::to_string(static_cast<std::int64_t>(rng() % 2'000'000'000'000) - 1'000'000'000'000);
+        text.push_back(' ');
+    }
+    return text;
+}
+
+template <typename Parse>
+static void run(const std::string& label, const std::string& text, Parse parse) {
+    bench::reportBytes(label, text.size(), bench::bestOfMs([&] {
+        std::vector<std::int64_t> values;
+        std::size_t malformed = 0;
+        utils::tokenize(text, utils::Delimiter::whitespace(), [&](std::span<const utils::Token> batch) {
+            for (const auto& t : batch) {
+                std::int64_t v;
+                if (parse(std::string_view(text).substr(t.offset, t.length), v)) values.push_back(v);
+                else ++malformed;
+            }
+        });
+        bench::doNotOptimize(values.size() + malformed);
+    }, 3));
+}
+
+int main() {
+    const std::size_t count = 2'000'000;
+    std::mt19937_64 rng(5);
+    for (int bad : {0, 10, 50}) {
+        std::string text = makeText(count, bad, rng);
+        std::string tag = std::to_string(bad) + "% malformed: ";
+        std::cout << "--- " << count << " tokens, " << tag << (text.size() >> 20) << " MiB ---\n";
+        run(tag + "std::stoll + try/catch", text, [](std::string_view s, std::int64_t& v) {
+            try { v = std::stoll(std::string(s)); return true; } catch (...) { return false; }
+        });
+        run(tag + "std::from_chars", text, [](std::string_view s, std::int64_t& v) {
+            auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), v);
+            return ec == std::errc{} && ptr == s.data() + s.size();
+        });
+        run(tag + "utils::parseInteger (SWAR)", text, [](std::string_view s, std::int64_t& v) {
+            return utils::parseInteger(s, v);
+        });
+    }
+    return 0;
+}
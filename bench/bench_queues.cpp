@@ -0,0 +1,129 @@
+// Hand-off between threads at producer:consumer = 1:1, 4:4 and 16:16: a mutex around ds::Queue
+// vs. the lock-free SpscRingQueue (1:1 only) and MpmcQueue, one element and 32-element batches per call.
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "bench/bench.hpp"
+#include "ds/containers/MpmcQueue.hpp"
+#include "ds/containers/Queue.hpp"
+#include "ds/containers/SpscRingQueue.hpp"
+
+constexpr std::size_t kItems = 2'000'000;
+constexpr std::size_t kBatch = 32;
+constexpr std::size_t kCapacity = 4096;
+
+// Splits kItems over the producers, runs them against the consumers and returns the checksum
+// the consumers saw. produce(p, first, last) enqueues values [first, last); consume(sum) returns
+// how many elements it took (0 when the queue was empty).
+template <typename Produce, typename Consume>
+std::uint64_t handOff(std::size_t producers, std::size_t consumers, Produce produce, Consume consume) {
+    std::atomic<std::size_t> taken{0};
+    std::atomic<std::uint64_t> checksum{0};
+    std::vector<std::thread> threads;
+    for (std::size_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] { produce(kItems * p / producers, kItems * (p + 1) / producers); });
+    }
+    for (std::size_t c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            std::uint64_t sum = 0;
+            while (taken.load(std::memory_order_relaxed) < kItems) {
+                std::size_t k = consume(sum);
+                if (k) taken.fetch_add(k, std::memory_order_relaxed);
+                else std::this_thread::yield();
+            }
+            checksum.fetch_add(sum);
+        });
+    }
+    for (auto& t : threads) t.join();
+    return checksum.load();
+}
+
+void run(const std::string& name, std::size_t producers, std::size_t consumers, auto once) {
+    const std::uint64_t expected = std::uint64_t{kItems} * (kItems - 1) / 2;
+    std::uint64_t got = 0;
+    double ms = bench::bestOfMs([&] { got = once(producers, consumers); }, 3);
+    bench::report(name, kItems, ms);
+    if (got != expected) std::cout << "  checksum mismatch: " << got << " != " << expected << "\n";
+}
+
+int main() {
+    auto mutexQueue = [](std::size_t producers, std::size_t consumers) {
+        ds::Queue<std::uint64_t> q;
+        std::mutex m;
+        return handOff(producers, consumers,
+            [&](std::size_t first, std::size_t last) {
+                for (std::size_t i = first; i < last; ++i) {
+                    std::lock_guard<std::mutex> lock(m);
+                    q.enqueue(i);
+                }
+            },
+            [&](std::uint64_t& sum) -> std::size_t {
+                std::lock_guard<std::mutex> lock(m);
+                if (q.empty()) return 0;
+                sum += q.front();
+                q.dequeue();
+                return 1;
+            });
+    };
+    auto mpmc = [](std::size_t producers, std::size_t consumers) {
+        ds::MpmcQueue<std::uint64_t> q(kCapacity);
+        return handOff(producers, consumers,
+            [&](std::size_t first, std::size_t last) {
+                for (std::size_t i = first; i < last; ++i) q.enqueue(i);
+            },
+            [&](std::uint64_t& sum) -> std::size_t {
+                std::uint64_t x;
+                if (!q.try_dequeue(x)) return 0;
+                sum += x;
+                return 1;
+            });
+    };
+    auto mpmcBulk = [](std::size_t producers, std::size_t consumers) {
+        ds::MpmcQueue<std::uint64_t> q(kCapacity);
+        return handOff(producers, consumers,
+            [&](std::size_t first, std::size_t last) {
+                std::uint64_t batch[kBatch];
+                for (std::size_t i = first; i < last;) {
+                    std::size_t n = std::min(kBatch, last - i);
+                    for (std::size_t j = 0; j < n; ++j) batch[j] = i + j;
+                    for (std::size_t done = 0; done < n;) {
+                        std::size_t k = q.try_enqueue_bulk(batch + done, n - done);
+                        if (!k) std::this_thread::yield();
+                        done += k;
+                    }
+                    i += n;
+                }
+            },
+            [&](std::uint64_t& sum) -> std::size_t {
+                std::uint64_t batch[kBatch];
+                std::size_t k = q.try_dequeue_bulk(batch, kBatch);
+                for (std::size_t j = 0; j < k; ++j) sum += batch[j];
+                return k;
+            });
+    };
+    auto spsc = [](std::size_t producers, std::size_t consumers) {
+        ds::SpscRingQueue<std::uint64_t> q(kCapacity);
+        return handOff(producers, consumers,
+            [&](std::size_t first, std::size_t last) {
+                for (std::size_t i = first; i < last; ++i) q.enqueue_wait(i);
+            },
+            [&](std::uint64_t& sum) -> std::size_t {
+                std::uint64_t batch[kBatch];
+                std::size_t k = q.try_dequeue_bulk(batch, kBatch);
+                for (std::size_t j = 0; j < k; ++j) sum += batch[j];
+                return k;
+            });
+    };
+
+    for (std::size_t threads : {1, 4, 16}) {
+        std::cout << "--- " << threads << " producers : " << threads << " consumers, " << kItems << " items ---\n";
+        run("mutex + ds::Queue", threads, threads, mutexQueue);
+        if (threads == 1) run("SpscRingQueue", 1, 1, spsc);
+        run("MpmcQueue", threads, threads, mpmc);
+        run("MpmcQueue bulk x" + std::to_string(kBatch), threads, threads, mpmcBulk);
+    }
+    return 0;
+}
@@ -0,0 +1,48 @@
+// Queue/Deque throughput: LinkedListStorage (default) vs. RingBufferStorage.
+#include <string>
+#include "bench/bench.hpp"
+#include "ds/containers/Queue.hpp"
+#include "ds/containers/Deque.hpp"
+#include "ds/storage/RingBufferStorage.hpp"
+#include "ds/algorithms.hpp"
+
+template <typename Q>
+void runQueue(const std::string& name, std::size_t n) {
+    bench::report(name + " fill then drain", 2 * n, bench::bestOfMs([&] {
+        Q q;
+        for (std::size_t i = 0; i < n; ++i) q.enqueue(static_cast<int>(i));
+        while (!q.empty()) q.dequeue();
+    }));
+
+    bench::report(name + " sustained (window 1024)", 2 * n, bench::bestOfMs([&] {
+        Q q;
+        for (int i = 0; i < 1024; ++i) q.enqueue(i);
+        for (std::size_t i = 0; i < n; ++i) { q.enqueue(static_cast<int>(i)); q.dequeue(); }
+        bench::doNotOptimize(q.front());
+    }));
+
+    Q q;
+    for (std::size_t i = 0; i < n; ++i) q.enqueue(static_cast<int>(i));
+    bench::report(name + " reduce scan", n, bench::bestOfMs([&] {
+        bench::doNotOptimize(ds::reduce(q, 0LL, [](long long a, int x) { return a + x; }));
+    }));
+}
+
+template <typename D>
+void runDeque(const std::string& name, std::size_t n) {
+    bench::report(name + " push both ends, pop both", 2 * n, bench::bestOfMs([&] {
+        D d;
+        for (std::size_t i = 0; i < n / 2; ++i) { d.push_back(static_cast<int>(i)); d.push_front(static_cast<int>(i)); }
+        while (!d.empty()) { d.pop_back(); if (!d.empty()) d.pop_front(); }
+    }));
+}
+
+int main() {
+    const std::size_t n = 1'000'000;
+    std::cout << "--- Queue/Deque storage throughput (N = " << n << ") ---\n";
+    runQueue<ds::Queue<int>>("Queue<LinkedList>", n);
+    runQueue<ds::Queue<int, ds::RingBufferStorage<int>>>("Queue<RingBuffer>", n);
+    runDeque<ds::Deque<int>>("Deque<LinkedList>", n);
+    runDeque<ds::Deque<int, ds::RingBufferStorage<int>>>("Deque<RingBuffer>", n);
+    return 0;
+}
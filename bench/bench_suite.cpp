@@ -0,0 +1,204 @@
+// Microbenchmark suite: container push/pop per storage backend and the core algorithms, for int
+// and std::string at N = 1e3 .. 1e7. Prints one JSON document to stdout (progress goes to stderr).
+//
+//   bench/bench_suite [--max-n N] [--reps R] > results.json
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "bench/bench.hpp"
+#include "ds/algorithms.hpp"
+#include "ds/containers/Deque.hpp"
+#include "ds/containers/PriorityQueue.hpp"
+#include "ds/containers/Queue.hpp"
+#include "ds/containers/Stack.hpp"
+#include "ds/storage/LinkedListStorage.hpp"
+#include "ds/storage/RingBufferStorage.hpp"
+#include "ds/storage/UnrolledListStorage.hpp"
+#include "ds/storage/VectorHeapStorage.hpp"
+
+#ifndef BENCH_VARIANT
+#define BENCH_VARIANT "unspecified"
+#endif
+
+namespace {
+
+struct Options {
+    std::size_t maxN = 10'000'000;
+    int reps = 0;   // 0: scale with N
+};
+
+std::vector<bench::Result> results;
+Options options;
+
+// Small inputs are cheap and noisy, so they get more repetitions.
+int repsFor(std::size_t n) {
+    if (options.reps > 0) return options.reps;
+    return n <= 1'000 ? 101 : n <= 10'000 ? 31 : n <= 100'000 ? 11 : n <= 1'000'000 ? 5 : 3;
+}
+
+template <typename F>
+void measure(const std::string& group, const std::string& subject, const std::string& variant,
+             const std::string& type, const std::string& op, std::size_t n, std::size_t ops, F&& f) {
+    bench::Result r{group, subject, variant, type, op, n, ops, {}};
+    r.stats = bench::sampleMs(f, 1, repsFor(n));
+    std::cerr << subject << "<" << variant << "> " << type << " " << op << " n=" << n
+              << ": median " << r.stats.medianMs << " ms\n";
+    results.push_back(std::move(r));
+}
+
+// Element-type specific inputs and callbacks, so every benchmark body is written once.
+template <typename T> struct Traits;
+
+template <> struct Traits<int> {
+    static constexpr const char* name = "int";
+    static int make(std::uint64_t r) { return static_cast<int>(r % 1'000'000'000); }
+    // Inputs reach 999,999,999, so x * 3 + 1 would overflow int; wrap in unsigned instead.
+    static int mapFn(int x) { return static_cast<int>(static_cast<unsigned>(x) * 3u + 1u); }
+    static bool keep(int x) { return x % 3 == 0; }
+    static long long fold(long long acc, int x) { return acc + x; }
+};
+
+template <> struct Traits<std::string> {
+    static constexpr const char* name = "string";
+    // Decimal strings of 1 to 10 characters: all within the small-string buffer, like most words.
+    static std::string make(std::uint64_t r) { return std::to_string(r % 1'000'000'000); }
+    static std::string mapFn(const std::string& s) { return s + '!'; }
+    static bool keep(const std::string& s) { return s[0] < '4'; }
+    static long long fold(long long acc, const std::string& s) { return acc + static_cast<long long>(s.size()); }
+};
+
+template <typename T>
+std::vector<T> makeInput(std::size_t n) {
+    std::mt19937_64 rng(n);
+    std::vector<T> values;
+    values.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) values.push_back(Traits<T>::make(rng()));
+    return values;
+}
+
+// --- Containers: fill with n elements, then drain (2n operations) ---
+
+template <typename S, typename T>
+void runStack(const std::string& storage, const std::vector<T>& in) {
+    measure("container", "Stack", storage, Traits<T>::name, "push+pop", in.size(), 2 * in.size(), [&] {
+        ds::Stack<T, S> s;
+        for (const T& x : in) s.push(x);
+        while (!s.empty()) s.pop();
+        bench::doNotOptimize(s.size());
+    });
+}
+
+template <typename S, typename T>
+void runQueue(const std::string& storage, const std::vector<T>& in) {
+    measure("container", "Queue", storage, Traits<T>::name, "enqueue+dequeue", in.size(), 2 * in.size(), [&] {
+        ds::Queue<T, S> q;
+        for (const T& x : in) q.enqueue(x);
+        while (!q.empty()) q.dequeue();
+        bench::doNotOptimize(q.size());
+    });
+}
+
+template <typename S, typename T>
+void runDeque(const std::string& storage, const std::vector<T>& in) {
+    measure("container", "Deque", storage, Traits<T>::name, "push both ends+pop both ends", in.size(),
+            2 * in.size(), [&] {
+        ds::Deque<T, S> d;
+        for (std::size_t i = 0; i < in.size(); ++i) {
+            if (i & 1) d.push_front(in[i]);
+            else d.push_back(in[i]);
+        }
+        for (std::size_t i = 0; !d.empty(); ++i) {
+            if (i & 1) d.pop_front();
+            else d.pop_back();
+        }
+        bench::doNotOptimize(d.size());
+    });
+}
+
+template <typename T>
+void runPriorityQueue(const std::vector<T>& in) {
+    measure("container", "PriorityQueue", "VectorHeap", Traits<T>::name, "push+pop", in.size(), 2 * in.size(), [&] {
+        ds::PriorityQueue<T> pq;
+        for (const T& x : in) pq.push(x);
+        while (!pq.empty()) pq.pop();
+        bench::doNotOptimize(pq.size());
+    });
+}
+
+template <typename T>
+void runContainers(const std::vector<T>& in) {
+    runStack<ds::LinkedListStorage<T>>("LinkedList", in);
+    runStack<ds::PooledLinkedListStorage<T>>("PooledLinkedList", in);
+    runStack<ds::RingBufferStorage<T>>("RingBuffer", in);
+    runStack<ds::UnrolledListStorage<T>>("UnrolledList", in);
+    runQueue<ds::LinkedListStorage<T>>("LinkedList", in);
+    runQueue<ds::PooledLinkedListStorage<T>>("PooledLinkedList", in);
+    runQueue<ds::RingBufferStorage<T>>("RingBuffer", in);
+    runQueue<ds::UnrolledListStorage<T>>("UnrolledList", in);
+    runDeque<ds::LinkedListStorage<T>>("LinkedList", in);
+    runDeque<ds::PooledLinkedListStorage<T>>("PooledLinkedList", in);
+    runDeque<ds::RingBufferStorage<T>>("RingBuffer", in);
+    runDeque<ds::UnrolledListStorage<T>>("UnrolledList", in);
+    runPriorityQueue(in);
+}
+
+// --- Algorithms over a LinkedListStorage input (the library's default container) ---
+
+template <typename T>
+void runAlgorithms(const std::vector<T>& in) {
+    using Tr = Traits<T>;
+    const std::string variant = "LinkedList";
+    const std::size_t n = in.size();
+    ds::LinkedListStorage<T> list;
+    for (const T& x : in) list.push_back(x);
+
+    measure("algorithm", "map", variant, Tr::name, "map", n, n, [&] {
+        bench::doNotOptimize(ds::map(list, [](const T& x) { return Tr::mapFn(x); }).size());
+    });
+    measure("algorithm", "filter", variant, Tr::name, "filter", n, n, [&] {
+        bench::doNotOptimize(ds::filter(list, [](const T& x) { return Tr::keep(x); }).size());
+    });
+    measure("algorithm", "reduce", variant, Tr::name, "reduce", n, n, [&] {
+        bench::doNotOptimize(ds::reduce(list, 0LL, [](long long acc, const T& x) { return Tr::fold(acc, x); }));
+    });
+    measure("algorithm", "flatMap", variant, Tr::name, "flatMap x2", n, 2 * n, [&] {
+        bench::doNotOptimize(ds::flatMap(list, [](const T& x) {
+            ds::LinkedListStorage<T> pair;
+            pair.push_back(x);
+            pair.push_back(x);
+            return pair;
+        }).size());
+    });
+    measure("algorithm", "sort", variant, Tr::name, "sort", n, n, [&] {
+        bench::doNotOptimize(ds::sort(list).size());
+    });
+    measure("algorithm", "countInversions", variant, Tr::name, "countInversions", n, n, [&] {
+        bench::doNotOptimize(ds::countInversions(list));
+    });
+}
+
+template <typename T>
+void runAll() {
+    for (std::size_t n = 1'000; n <= options.maxN; n *= 10) {
+        // Scoped per size, so at most one input of each kind is alive at a time.
+        std::vector<T> in = makeInput<T>(n);
+        runContainers(in);
+        runAlgorithms(in);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string_view flag = argv[i];
+        if (flag == "--max-n") options.maxN = static_cast<std::size_t>(std::strtod(argv[i + 1], nullptr));
+        else if (flag == "--reps") options.reps = std::atoi(argv[i + 1]);
+    }
+    runAll<int>();
+    runAll<std::string>();
+    bench::writeJson(std::cout, BENCH_VARIANT, results);
+    return 0;
+}
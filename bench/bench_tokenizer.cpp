@@ -0,0 +1,48 @@
+// Whitespace tokenizing throughput: istream >> word vs. the scalar, SSE2 and AVX2 kernels.
+#include <random>
+#include <span>
+#include <sstream>
+#include <string>
+#include "bench/bench.hpp"
+#include "utils/Tokenizer.hpp"
+
+static std::string makeText(std::size_t bytes, std::mt19937& rng) {
+    std::string text;
+    text.reserve(bytes + 16);
+    while (text.size() < bytes) {
+        std::size_t len = 2 + rng() % 9;
+        for (std::size_t i = 0; i < len; ++i) text.push_back(static_cast<char>('a' + rng() % 26));
+        text.push_back(rng() % 12 == 0 ? '\n' : ' ');
+    }
+    return text;
+}
+
+static void runKernel(const std::string& name, const std::string& text, utils::SimdLevel level) {
+    bench::reportBytes(name, text.size(), bench::bestOfMs([&] {
+        std::size_t tokens = 0;
+        utils::tokenize(text, utils::Delimiter::whitespace(),
+                        [&](std::span<const utils::Token> batch) { tokens += batch.size(); }, level);
+        bench::doNotOptimize(tokens);
+    }));
+}
+
+int main() {
+    const std::size_t bytes = 64u << 20;
+    std::mt19937 rng(3);
+    std::string text = makeText(bytes, rng);
+
+    const char* levels[] = {"scalar", "SSE2", "AVX2"};
+    std::cout << "--- Whitespace tokenizer (" << (text.size() >> 20) << " MiB of text, CPU supports "
+              << levels[static_cast<int>(utils::bestSimdLevel())] << ") ---\n";
+    bench::reportBytes("istringstream >> word", text.size(), bench::bestOfMs([&] {
+        std::istringstream in(text);
+        std::string word;
+        std::size_t tokens = 0;
+        while (in >> word) ++tokens;
+        bench::doNotOptimize(tokens);
+    }, 2));
+    runKernel("tokenize scalar", text, utils::SimdLevel::Scalar);
+    runKernel("tokenize SSE2", text, utils::SimdLevel::SSE2);
+    if (utils::bestSimdLevel() == utils::SimdLevel::AVX2) runKernel("tokenize AVX2", text, utils::SimdLevel::AVX2);
+    return 0;
+}
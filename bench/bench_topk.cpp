@@ -0,0 +1,47 @@
+// Top-k of N random ints: full sort + prefix vs. ds::topK (bounded heap / introselect) vs. ds::topK(ds::par, ...).
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+#include "bench/bench.hpp"
+#include "ds/algorithms.hpp"
+#include "ds/storage/LinkedListStorage.hpp"
+
+int main() {
+    const std::size_t n = 10'000'000;
+    std::mt19937 rng(20);
+    std::vector<int> values(n);
+    for (auto& v : values) v = static_cast<int>(rng() >> 1);
+    ds::LinkedListStorage<int> list;
+    for (int v : values) list.push_back(v);
+    const auto cmp = std::greater<int>{};
+
+    for (std::size_t k : {10, 1'000, 100'000, 1'000'000}) {
+        std::cout << "--- N = " << n << ", k = " << k << " ---\n";
+        bench::report("vector: stable_sort, keep k", n, bench::bestOfMs([&] {
+            std::vector<int> copy = values;
+            std::stable_sort(copy.begin(), copy.end(), cmp);
+            copy.resize(k);
+            bench::doNotOptimize(copy.back());
+        }, 3));
+        // Below the introselect threshold this is the heap; above it, nth_element over positions.
+        bench::report("vector: ds::topK", n, bench::bestOfMs([&] {
+            auto top = ds::topK<std::vector<int>>(values, k, cmp);
+            bench::doNotOptimize(top.back());
+        }, 3));
+        bench::report("vector: ds::topK(par)", n, bench::bestOfMs([&] {
+            auto top = ds::topK<std::vector<int>>(ds::par, values, k, cmp);
+            bench::doNotOptimize(top.back());
+        }, 3));
+        bench::report("list: ds::sort, keep k", n, bench::bestOfMs([&] {
+            auto sorted = ds::sort<std::vector<int>>(list, cmp);
+            sorted.resize(k);
+            bench::doNotOptimize(sorted.back());
+        }, 3));
+        bench::report("list: ds::topK (heap)", n, bench::bestOfMs([&] {
+            auto top = ds::topK<std::vector<int>>(list, k, cmp);
+            bench::doNotOptimize(top.back());
+        }, 3));
+    }
+    return 0;
+}
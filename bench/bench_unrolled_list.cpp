@@ -0,0 +1,66 @@
+// LinkedListStorage vs. UnrolledListStorage: heap footprint and scan speed.
+#include <cstdlib>
+#include <new>
+#include <string>
+#include "bench/bench.hpp"
+#include "ds/containers/Deque.hpp"
+#include "ds/storage/UnrolledListStorage.hpp"
+#include "ds/algorithms.hpp"
+
+// Counts live heap bytes so the footprint of each storage can be reported.
+static std::size_t g_liveBytes = 0;
+
+void* operator new(std::size_t n) {
+    void* p = std::malloc(n + 16);
+    if (!p) throw std::bad_alloc();
+    *static_cast<std::size_t*>(p) = n;
+    g_liveBytes += n;
+    return static_cast<char*>(p) + 16;
+}
+void operator delete(void* p) noexcept {
+    if (!p) return;
+    char* base = static_cast<char*>(p) - 16;
+    g_liveBytes -= *reinterpret_cast<std::size_t*>(base);
+    std::free(base);
+}
+void operator delete(void* p, std::size_t) noexcept { operator delete(p); }
+
+template <typename S>
+void run(const std::string& name, std::size_t n) {
+    std::size_t before = g_liveBytes;
+    {
+        S s;
+        for (std::size_t i = 0; i < n; ++i) s.push_back(static_cast<int>(i));
+        std::cout << name << " heap bytes/element: "
+                  << std::fixed << std::setprecision(2)
+                  << double(g_liveBytes - before) / n << "\n";
+
+        bench::report(name + " forEach", n, bench::bestOfMs([&] {
+            long long acc = 0;
+            ds::forEach(s, [&](int x) { acc += x; });
+            bench::doNotOptimize(acc);
+        }));
+        bench::report(name + " reduce", n, bench::bestOfMs([&] {
+            bench::doNotOptimize(ds::reduce(s, 0LL, [](long long a, int x) { return a + x; }));
+        }));
+    }
+    bench::report(name + " push_back+destroy", n, bench::bestOfMs([&] {
+        S s;
+        for (std::size_t i = 0; i < n; ++i) s.push_back(static_cast<int>(i));
+        bench::doNotOptimize(s.size());
+    }));
+    bench::report(name + " Deque push/pop both ends", 2 * n, bench::bestOfMs([&] {
+        ds::Deque<int, S> d;
+        for (std::size_t i = 0; i < n / 2; ++i) { d.push_back(static_cast<int>(i)); d.push_front(static_cast<int>(i)); }
+        while (!d.empty()) { d.pop_front(); if (!d.empty()) d.pop_back(); }
+    }));
+}
+
+int main() {
+    const std::size_t n = 1'000'000;
+    std::cout << "--- Sequence storage footprint and scans (N = " << n << ") ---\n";
+    run<ds::LinkedListStorage<int>>("LinkedList<int>", n);
+    run<ds::UnrolledListStorage<int>>("Unrolled<int, 64>", n);
+    run<ds::UnrolledListStorage<int, 256>>("Unrolled<int, 256>", n);
+    return 0;
+}
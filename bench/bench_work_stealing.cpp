@@ -0,0 +1,115 @@
+// WorkStealingDeque (Chase-Lev): a stress check of owner pops against concurrent thieves, owner
+// push/pop cost vs. a mutex-guarded std::deque, and fork-join work on the ds::ThreadPool built on it.
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "bench/bench.hpp"
+#include "ds/algorithms.hpp"
+#include "ds/containers/WorkStealingDeque.hpp"
+#include "ds/parallel/ThreadPool.hpp"
+
+// The owner pushes 0..n-1 in bursts and pops some of them back while the thieves steal.
+// Every value must come out exactly once; returns false (and says why) otherwise.
+bool stress(std::size_t n, std::size_t thieves) {
+    ds::WorkStealingDeque<std::uint32_t> dq(4);   // small start: exercises growth under stealing
+    std::vector<std::atomic<std::uint8_t>> seen(n);
+    std::atomic<bool> done{false};
+    std::atomic<std::size_t> stolen{0};
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < thieves; ++t) {
+        threads.emplace_back([&] {
+            std::uint32_t x;
+            std::size_t mine = 0;
+            while (!done.load(std::memory_order_acquire) || !dq.empty()) {
+                if (dq.try_steal(x)) { seen[x].fetch_add(1); ++mine; }
+            }
+            stolen.fetch_add(mine);
+        });
+    }
+    std::mt19937 rng(23);
+    std::size_t popped = 0;
+    std::uint32_t x;
+    for (std::uint32_t next = 0; next < n;) {
+        for (std::size_t burst = rng() % 64; burst-- > 0 && next < n;) dq.push(next++);
+        for (std::size_t pops = rng() % 48; pops-- > 0 && dq.try_pop(x);) { seen[x].fetch_add(1); ++popped; }
+    }
+    while (dq.try_pop(x)) { seen[x].fetch_add(1); ++popped; }
+    done.store(true, std::memory_order_release);
+    for (auto& t : threads) t.join();
+    std::size_t bad = 0;
+    for (auto& s : seen) bad += s.load() != 1;
+    std::cout << "stress " << thieves << " thieves: " << n << " pushed, " << popped << " popped, " << stolen.load()
+              << " stolen, capacity " << dq.capacity() << (bad ? ", " + std::to_string(bad) + " LOST OR DUPLICATED" : ", ok")
+              << "\n";
+    return bad == 0;
+}
+
+// --stress-only runs just the correctness check (make test).
+int main(int argc, char** argv) {
+    bool ok = true;
+    for (std::size_t thieves : {1, 3, 7}) ok = stress(2'000'000, thieves) && ok;
+    if (argc > 1 && std::string_view(argv[1]) == "--stress-only") return ok ? 0 : 1;
+
+    const std::size_t ops = 10'000'000;
+    std::cout << "--- owner push + pop, " << ops << " ops ---\n";
+    bench::report("mutex + std::deque", ops, bench::bestOfMs([&] {
+        std::deque<std::uint32_t> dq;
+        std::mutex m;
+        std::uint64_t sum = 0;
+        for (std::uint32_t i = 0; i < ops / 2; ++i) {
+            { std::lock_guard<std::mutex> lk(m); dq.push_back(i); }
+            if (i % 4 == 3) {
+                for (int k = 0; k < 4; ++k) { std::lock_guard<std::mutex> lk(m); sum += dq.back(); dq.pop_back(); }
+            }
+        }
+        bench::doNotOptimize(sum);
+    }, 3));
+    bench::report("WorkStealingDeque", ops, bench::bestOfMs([&] {
+        ds::WorkStealingDeque<std::uint32_t> dq;
+        std::uint64_t sum = 0;
+        std::uint32_t x = 0;
+        for (std::uint32_t i = 0; i < ops / 2; ++i) {
+            dq.push(i);
+            if (i % 4 == 3) {
+                for (int k = 0; k < 4; ++k) { dq.try_pop(x); sum += x; }
+            }
+        }
+        bench::doNotOptimize(sum);
+    }, 3));
+
+    // Fork-join: the parallel algorithms schedule their chunks through ThreadPool::run,
+    // whose workers now own WorkStealingDeques; the nested run() tree stresses spawn/steal.
+    const std::size_t n = 1'000'000;
+    std::mt19937 rng(23);
+    std::vector<int> values(n);
+    for (auto& v : values) v = static_cast<int>(rng() >> 1);
+    for (std::size_t threads : {1, 2, 4, 8}) {
+        ds::ThreadPool pool(threads);
+        auto policy = ds::par.on(pool);
+        std::cout << "--- fork-join, " << threads << " threads, N = " << n << " ---\n";
+        bench::report("par sort (vector)", n, bench::bestOfMs([&] {
+            auto sorted = ds::sort(policy, values);
+            bench::doNotOptimize(sorted.back());
+        }, 3));
+        bench::report("par countInversions (vector)", n, bench::bestOfMs([&] {
+            bench::doNotOptimize(ds::countInversions(policy, values));
+        }, 3));
+        // Binary task tree of nested run(2) calls: about 2^16 tiny tasks through the deques.
+        std::atomic<std::uint64_t> leaves{0};
+        auto tree = [&](auto& self, unsigned depth) -> void {
+            if (depth == 0) { leaves.fetch_add(1, std::memory_order_relaxed); return; }
+            pool.run(2, [&](std::size_t) { self(self, depth - 1); });
+        };
+        bench::report("nested run(2) tree, 2^16 leaves", std::size_t{1} << 16, bench::bestOfMs([&] {
+            tree(tree, 16);
+        }, 3));
+    }
+    return ok ? 0 : 1;
+}
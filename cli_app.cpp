@@ -63,12 +63,11 @@ void runNumericMode() {
             std::cout << "Enter filename: ";
             std::string fname;
             std::cin >> fname;
-            // Reuse FileHandler readWords but parse as int
-            auto words = utils::FileHandler::readWords(fname);
-            data = ds::map(words, [](const std::string& s) {
-                try { return std::stoi(s); } catch(...) { return 0; }
-            });
+            // Parse integers straight out of the file; malformed tokens are skipped and counted
+            auto loaded = utils::FileHandler::readIntegers<int>(fname);
+            data = ds::collect<ds::LinkedListStorage<int>>(loaded.values);
             std::cout << "Loaded " << data.size() << " integers.\n";
+            if (loaded.malformed) std::cout << "Skipped " << loaded.malformed << " malformed tokens.\n";
             pressEnterToContinue();
         } else if (choice == 2) {
             std::cout << "Enter numbers (non-number to stop): ";
@@ -82,19 +81,19 @@ void runNumericMode() {
             std::cout << "Filter values greater than: ";
             int threshold;
             std::cin >> threshold;
-            data = ds::filter(data, [=](int x) { return x > threshold; });
+            data = ds::filter(std::move(data), [=](int x) { return x > threshold; });
             std::cout << "Filtered.\n";
         } else if (choice == 4) {
             std::cout << "Multiply all by: ";
             int factor;
             std::cin >> factor;
-            data = ds::map(data, [=](int x) { return x * factor; });
+            data = ds::map(std::move(data), [=](int x) { return x * factor; });
             std::cout << "Mapped.\n";
         } else if (choice == 5) {
-            data = ds::sort(data);
+            data = ds::sort(std::move(data));
             std::cout << "Sorted Ascending.\n";
         } else if (choice == 6) {
-            data = ds::sort(data, std::greater<int>{});
+            data = ds::sort(std::move(data), std::greater<int>{});
             std::cout << "Sorted Descending.\n";
         } else if (choice == 7) {
             if (data.empty()) {
@@ -159,22 +158,21 @@ void runTextMode() {
             std::cout << "Keep words containing: ";
             std::string sub;
             std::cin >> sub;
-            data = ds::filter(data, [=](const std::string& s) {
+            data = ds::filter(std::move(data), [=](const std::string& s) {
                 return s.find(sub) != std::string::npos;
             });
             std::cout << "Filtered.\n";
         } else if (choice == 3) {
-            data = ds::map(data, [](const std::string& s) {
-                std::string upper = s;
+            data = ds::map(std::move(data), [](std::string upper) {
                 for(auto& c : upper) c = toupper(c);
                 return upper;
             });
             std::cout << "Converted to Uppercase.\n";
         } else if (choice == 4) {
-            data = ds::sort(data);
+            data = ds::sort(std::move(data));
             std::cout << "Sorted Alphabetically.\n";
         } else if (choice == 5) {
-            data = ds::sort(data, [](const std::string& a, const std::string& b) {
+            data = ds::sort(std::move(data), [](const std::string& a, const std::string& b) {
                 return a.length() < b.length();
             });
             std::cout << "Sorted by Length.\n";
@@ -182,9 +180,12 @@ void runTextMode() {
             if (data.empty()) {
                 std::cout << "No data.\n";
             } else {
-                std::string longest = ds::reduce(data, std::string(""), [](const std::string& acc, const std::string& curr) {
-                    return curr.length() > acc.length() ? curr : acc;
+                // One pass that copies only the winner (the reduce copied its accumulator per word);
+                // ties keep the first longest word.
+                auto top = ds::topK(data, 1, [](const std::string& a, const std::string& b) {
+                    return a.length() > b.length();
                 });
+                const std::string& longest = top.front();
                 std::cout << "Longest Word: " << longest << " (Length: " << longest.length() << ")\n";
             }
             pressEnterToContinue();
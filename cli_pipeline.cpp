@@ -1,3 +1,7 @@
+// "profile" counts heap allocations and list nodes only in a build with -DDS_PROFILE_ALLOCATIONS
+// (make cli_pipeline_profile): the counters are atomics on every allocation, which the plain
+// build should not pay for. Without it those columns print n/a.
+
 #include <iostream>
 #include <string>
 #include <vector>
@@ -6,28 +10,425 @@
 #include <map>
 #include <limits>
 #include <algorithm>
+#include <iomanip>
+#include <span>
+#include <string_view>
+#include <cstdint>
+#include <chrono>
 
 #include "ds/algorithms.hpp"
+#include "ds/columnar/Kernels.hpp"
+#include "ds/profiling/CountingNew.hpp"
 #include "ds/storage/LinkedListStorage.hpp"
 #include "utils/FileIO.hpp"
+#include "utils/Tokenizer.hpp"
 
 // --- Helper: Split string by delimiter ---
 std::vector<std::string> split(const std::string& s, char delimiter) {
     std::vector<std::string> tokens;
-    std::string token;
-    std::istringstream tokenStream(s);
-    while (std::getline(tokenStream, token, delimiter)) {
-        // Trim whitespace
-        size_t first = token.find_first_not_of(" \t");
-        if (first == std::string::npos) continue; // Skip empty
-        size_t last = token.find_last_not_of(" \t");
-        tokens.push_back(token.substr(first, (last - first + 1)));
-    }
+    utils::tokenize(s, utils::Delimiter::of(delimiter), [&](std::span<const utils::Token> batch) {
+        for (const auto& t : batch) {
+            std::string_view token(s.data() + t.offset, t.length);
+            // Trim whitespace
+            size_t first = token.find_first_not_of(" \t");
+            if (first == std::string_view::npos) continue; // Skip empty
+            size_t last = token.find_last_not_of(" \t");
+            tokens.emplace_back(token.substr(first, (last - first + 1)));
+        }
+    });
     return tokens;
 }
 
-int main() {
+// --- Query plan ---
+// A command line is parsed into stages before anything runs. Runs of adjacent filter/map
+// stages, together with the streaming terminals that follow them (show, count, sum, min, max), are
+// fused into one pass over the data; only load, manual, sort, top and inversions see the whole list.
+enum class StageKind { Load, Manual, Filter, Map, Sort, Top, Show, Count, Sum, Min, Max, Inversions, Unknown };
+enum class Op { None, Greater, Less, Equal, Multiply, Add, Subtract };
+
+struct Stage {
+    StageKind kind = StageKind::Unknown;
+    std::string text;         // the command as typed (for explain / messages)
+    Op op = Op::None;
+    int val = 0;              // filter / map operand, top k
+    std::string arg;          // load file name, sort / top order or unknown action
+    std::vector<int> values;  // manual
+};
+
+// What a fused stage observed during its pass.
+struct StageResult {
+    std::size_t out = 0;
+    long long sum = 0;
+    int extreme = 0;          // min / max, meaningful only when out > 0
+    std::string shown;
+};
+
+struct PlanStep {
+    bool fused = false;
+    std::vector<Stage> stages;   // exactly one stage unless fused
+};
+
+bool isFusable(StageKind kind) {
+    return kind == StageKind::Filter || kind == StageKind::Map || kind == StageKind::Show ||
+           kind == StageKind::Count || kind == StageKind::Sum || kind == StageKind::Min ||
+           kind == StageKind::Max;
+}
+
+Stage parseStage(const std::string& cmdStr) {
+    std::stringstream ss(cmdStr);
+    std::string action;
+    ss >> action;
+    Stage stage;
+    stage.text = cmdStr;
+    if (action == "load") {
+        stage.kind = StageKind::Load;
+        ss >> stage.arg;
+    } else if (action == "manual") {
+        stage.kind = StageKind::Manual;
+        int val;
+        while (ss >> val) stage.values.push_back(val);
+    } else if (action == "filter" || action == "map") {
+        stage.kind = action == "filter" ? StageKind::Filter : StageKind::Map;
+        std::string op;
+        ss >> op >> stage.val;
+        if (stage.kind == StageKind::Filter) {
+            stage.op = op == ">" ? Op::Greater : op == "<" ? Op::Less : op == "==" ? Op::Equal : Op::None;
+        } else {
+            stage.op = op == "*" ? Op::Multiply : op == "+" ? Op::Add : op == "-" ? Op::Subtract : Op::None;
+        }
+    } else if (action == "sort") {
+        stage.kind = StageKind::Sort;
+        ss >> stage.arg;
+    } else if (action == "top") {
+        stage.kind = StageKind::Top;
+        // Order defaults to desc: the k largest. A missing or bad k leaves val at 0, which
+        // the run loops reject with a usage line instead of emptying the data.
+        if (!(ss >> stage.val) || stage.val < 1) stage.val = 0;
+        else if (ss >> stage.arg && stage.arg != "asc" && stage.arg != "desc") stage.val = 0;
+    } else if (action == "show") {
+        stage.kind = StageKind::Show;
+    } else if (action == "count") {
+        stage.kind = StageKind::Count;
+    } else if (action == "sum") {
+        stage.kind = StageKind::Sum;
+    } else if (action == "min") {
+        stage.kind = StageKind::Min;
+    } else if (action == "max") {
+        stage.kind = StageKind::Max;
+    } else if (action == "inversions") {
+        stage.kind = StageKind::Inversions;
+    } else {
+        stage.arg = action;
+    }
+    return stage;
+}
+
+std::vector<PlanStep> buildPlan(const std::vector<std::string>& commands) {
+    std::vector<PlanStep> plan;
+    for (const auto& cmdStr : commands) {
+        Stage stage = parseStage(cmdStr);
+        bool fusable = isFusable(stage.kind);
+        if (fusable && !plan.empty() && plan.back().fused) {
+            plan.back().stages.push_back(std::move(stage));
+        } else {
+            plan.push_back(PlanStep{fusable, {}});
+            plan.back().stages.push_back(std::move(stage));
+        }
+    }
+    return plan;
+}
+
+// Runs x through a fused chain; returns false as soon as a filter drops it.
+bool pushThrough(int& x, const std::vector<Stage>& chain, std::vector<StageResult>& results) {
+    for (std::size_t i = 0; i < chain.size(); ++i) {
+        const Stage& stage = chain[i];
+        switch (stage.kind) {
+            case StageKind::Filter:
+                if ((stage.op == Op::Greater && !(x > stage.val)) || (stage.op == Op::Less && !(x < stage.val)) ||
+                    (stage.op == Op::Equal && !(x == stage.val))) {
+                    return false;
+                }
+                break;
+            case StageKind::Map:
+                // The columnar kernel's wrapping affine, so overflow is defined and both backends agree.
+                if (stage.op == Op::Multiply) ds::columnar::internal::affineScalar(&x, 0, 1, stage.val, 0);
+                else if (stage.op == Op::Add) ds::columnar::internal::affineScalar(&x, 0, 1, 1, stage.val);
+                else if (stage.op == Op::Subtract) {
+                    ds::columnar::internal::affineScalar(&x, 0, 1, 1, static_cast<int>(0u - static_cast<unsigned>(stage.val)));
+                }
+                break;
+            case StageKind::Show:
+                results[i].shown += std::to_string(x);
+                results[i].shown += ' ';
+                break;
+            case StageKind::Sum:
+                results[i].sum += x;
+                break;
+            case StageKind::Min:
+                if (results[i].out == 0 || x < results[i].extreme) results[i].extreme = x;
+                break;
+            case StageKind::Max:
+                if (results[i].out == 0 || x > results[i].extreme) results[i].extreme = x;
+                break;
+            default:
+                break;
+        }
+        ++results[i].out;
+    }
+    return true;
+}
+
+// Prints what each fused stage would have printed had it run on its own, in stage order.
+void reportFused(const std::vector<Stage>& chain, const std::vector<StageResult>& results) {
+    for (std::size_t i = 0; i < chain.size(); ++i) {
+        switch (chain[i].kind) {
+            case StageKind::Filter: std::cout << "[Filtered -> " << results[i].out << " items]\n"; break;
+            case StageKind::Map:    std::cout << "[Mapped]\n"; break;
+            case StageKind::Show:   std::cout << "Data: " << results[i].shown << "\n"; break;
+            case StageKind::Count:  std::cout << "Count: " << results[i].out << "\n"; break;
+            case StageKind::Sum:    std::cout << "Sum: " << results[i].sum << "\n"; break;
+            case StageKind::Min:
+            case StageKind::Max:
+                std::cout << (chain[i].kind == StageKind::Min ? "Min: " : "Max: ");
+                if (results[i].out) std::cout << results[i].extreme << "\n";
+                else std::cout << "(empty)\n";
+                break;
+            default: break;
+        }
+    }
+}
+
+// Fused pass over the current list: values are rewritten in place and dropped nodes unlinked.
+std::vector<StageResult> runFused(ds::LinkedListStorage<int>& data, const std::vector<Stage>& chain) {
+    std::vector<StageResult> results(chain.size());
+    data.remove_if([&](int& x) { return !pushThrough(x, chain, results); });
+    reportFused(chain, results);
+    return results;
+}
+
+// Fused pass straight off a freshly loaded buffer: only the survivors ever become list nodes.
+std::vector<StageResult> runFused(const std::vector<int>& incoming, ds::LinkedListStorage<int>& data,
+                                  const std::vector<Stage>& chain) {
+    std::vector<StageResult> results(chain.size());
+    ds::LinkedListStorage<int> out;
+    for (int x : incoming) {
+        if (pushThrough(x, chain, results)) out.push_back(x);
+    }
+    data = std::move(out);
+    reportFused(chain, results);
+    return results;
+}
+
+// --- Profiling ---
+// "profile <pipeline>" runs the line, then prints one row per stage: wall time, elements in and
+// out, heap allocations and bytes, and the peak number of live list nodes. A fused group is one
+// pass, so its time and allocation figures are shown once, on its first stage.
+struct ProfileRow {
+    std::string stage;
+    bool shared = false;      // later stage of a fused group: figures belong to the first row
+    double ms = 0;
+    std::size_t in = 0;
+    std::size_t out = 0;
+    std::size_t allocations = 0;
+    std::size_t bytes = 0;
+    std::size_t peakNodes = 0;
+};
+
+class Profiler {
+    bool on_;
+    std::vector<ProfileRow> rows_;
+    std::chrono::steady_clock::time_point start_;
+    ds::profiling::AllocSnapshot before_;
+    std::size_t in_ = 0;
+
+public:
+    explicit Profiler(bool on) : on_(on) {}
+
+    void begin(std::size_t in) {
+        if (!on_) return;
+        in_ = in;
+        ds::profiling::resetPeak();
+        before_ = ds::profiling::snapshot();
+        start_ = std::chrono::steady_clock::now();
+    }
+
+    // `results` holds one entry per stage of a fused step; other steps pass their output size.
+    void end(const PlanStep& step, const std::vector<StageResult>& results, std::size_t out) {
+        if (!on_) return;
+        auto stop = std::chrono::steady_clock::now();
+        ds::profiling::AllocSnapshot after = ds::profiling::snapshot();
+        std::size_t in = in_;
+        for (std::size_t i = 0; i < step.stages.size(); ++i) {
+            ProfileRow row;
+            row.stage = step.stages[i].text;
+            row.shared = i > 0;
+            row.in = in;
+            row.out = i < results.size() ? results[i].out : out;
+            if (i == 0) {
+                row.ms = std::chrono::duration<double, std::milli>(stop - start_).count();
+                row.allocations = after.allocations - before_.allocations;
+                row.bytes = after.bytes - before_.bytes;
+                row.peakNodes = after.peakLiveNodes;
+            }
+            in = row.out;
+            rows_.push_back(std::move(row));
+        }
+    }
+
+    void print() const {
+        if (!on_) return;
+        constexpr bool counted = ds::profiling::kAllocCountingEnabled;
+        std::cout << "Profile:\n" << std::left << std::setw(28) << "  stage" << std::right << std::setw(12) << "time ms"
+                  << std::setw(12) << "in" << std::setw(12) << "out" << std::setw(10) << "allocs" << std::setw(14)
+                  << "bytes" << std::setw(12) << "peak nodes" << "\n";
+        for (const auto& row : rows_) {
+            std::string label = (row.shared ? "  + " : "  ") + row.stage;
+            if (label.size() > 27) label = label.substr(0, 24) + "...";
+            std::cout << std::left << std::setw(28) << label << std::right;
+            if (row.shared) {
+                std::cout << std::setw(12) << "(fused)";
+            } else {
+                std::cout << std::setw(12) << std::fixed << std::setprecision(3) << row.ms;
+            }
+            std::cout << std::setw(12) << row.in << std::setw(12) << row.out;
+            if (row.shared) {
+                std::cout << std::setw(10) << "" << std::setw(14) << "" << std::setw(12) << "";
+            } else if (counted) {
+                std::cout << std::setw(10) << row.allocations << std::setw(14) << row.bytes << std::setw(12) << row.peakNodes;
+            } else {
+                std::cout << std::setw(10) << "n/a" << std::setw(14) << "n/a" << std::setw(12) << "n/a";
+            }
+            std::cout << "\n";
+        }
+    }
+};
+
+// --- Columnar backend ---
+// Same plan, different execution: the data lives in one aligned int32 column and every fused
+// stage is a single SIMD kernel over it (filters compact in place, maps are affine updates).
+enum class Backend { List, Columnar };
+
+// A fused step as whole-column kernels; results are reported exactly like the list pass.
+std::vector<StageResult> runFused(ds::columnar::Column<std::int32_t>& column, const std::vector<Stage>& chain) {
+    namespace col = ds::columnar;
+    std::vector<StageResult> results(chain.size());
+    for (std::size_t i = 0; i < chain.size(); ++i) {
+        const Stage& stage = chain[i];
+        switch (stage.kind) {
+            case StageKind::Filter:
+                if (stage.op == Op::Greater) col::filter(column, col::Compare::Greater, stage.val);
+                else if (stage.op == Op::Less) col::filter(column, col::Compare::Less, stage.val);
+                else if (stage.op == Op::Equal) col::filter(column, col::Compare::Equal, stage.val);
+                break;
+            case StageKind::Map:
+                if (stage.op == Op::Multiply) col::affine(column, stage.val, 0);
+                else if (stage.op == Op::Add) col::affine(column, 1, stage.val);
+                else if (stage.op == Op::Subtract) {
+                    col::affine(column, 1, static_cast<std::int32_t>(0u - static_cast<std::uint32_t>(stage.val)));
+                }
+                break;
+            case StageKind::Show:
+                for (int x : column) {
+                    results[i].shown += std::to_string(x);
+                    results[i].shown += ' ';
+                }
+                break;
+            case StageKind::Sum:
+                results[i].sum = col::sum(column);
+                break;
+            case StageKind::Min:
+                results[i].extreme = col::min(column).value_or(0);
+                break;
+            case StageKind::Max:
+                results[i].extreme = col::max(column).value_or(0);
+                break;
+            default:
+                break;
+        }
+        results[i].out = column.size();
+    }
+    reportFused(chain, results);
+    return results;
+}
+
+// Runs a whole command line against the column. Sources fill it directly: a column is cheap to
+// build, so there is no need to defer them into the following fused step.
+void runColumnar(const std::vector<PlanStep>& plan, ds::columnar::Column<std::int32_t>& column, Profiler& profiler) {
+    for (const auto& step : plan) {
+        const Stage& stage = step.stages.front();
+        std::vector<StageResult> results;
+        profiler.begin(column.size());
+        if (step.fused) {
+            results = runFused(column, step.stages);
+        } else if (stage.kind == StageKind::Load) {
+            auto loaded = utils::FileHandler::readIntegers<std::int32_t>(stage.arg);
+            column.assign(loaded.values.begin(), loaded.values.end());
+            std::cout << "[Loaded " << column.size() << " items";
+            if (loaded.malformed) std::cout << ", skipped " << loaded.malformed << " malformed tokens";
+            std::cout << "]\n";
+        } else if (stage.kind == StageKind::Manual) {
+            column.assign(stage.values.begin(), stage.values.end());
+            std::cout << "[Loaded " << column.size() << " items manually]\n";
+        } else if (stage.kind == StageKind::Sort) {
+            if (stage.arg == "desc") ds::sort_inplace(column, std::greater<std::int32_t>{});
+            else ds::sort_inplace(column);
+            std::cout << "[Sorted]\n";
+        } else if (stage.kind == StageKind::Top && stage.val < 1) {
+            std::cout << "Usage: top <k> [asc|desc]\n";
+        } else if (stage.kind == StageKind::Top) {
+            std::size_t k = static_cast<std::size_t>(stage.val);
+            using Column = ds::columnar::Column<std::int32_t>;
+            if (stage.arg == "asc") column = ds::topK<Column>(ds::par, column, k, std::less<std::int32_t>{});
+            else column = ds::topK<Column>(ds::par, column, k, std::greater<std::int32_t>{});
+            std::cout << "[Top " << column.size() << "]\n";
+        } else if (stage.kind == StageKind::Inversions) {
+            std::cout << "Inversions: " << ds::countInversions(ds::par, column) << "\n";
+        } else {
+            std::cout << "Unknown command: " << stage.arg << "\n";
+        }
+        profiler.end(step, results, column.size());
+    }
+}
+
+void explainPlan(const std::vector<PlanStep>& plan, Backend backend) {
+    std::cout << "Plan (" << plan.size() << " steps, " << (backend == Backend::Columnar ? "columnar" : "list")
+              << " backend):\n";
+    for (std::size_t i = 0; i < plan.size(); ++i) {
+        const PlanStep& step = plan[i];
+        std::string stages;
+        for (const auto& stage : step.stages) stages += (stages.empty() ? "" : " -> ") + stage.text;
+        std::string how;
+        switch (step.stages.front().kind) {
+            case StageKind::Load:
+            case StageKind::Manual:
+                how = "source";
+                break;
+            case StageKind::Sort:       how = "barrier: sorts the whole data set in place"; break;
+            case StageKind::Top:        how = "barrier: one pass with a bounded heap of k per thread"; break;
+            case StageKind::Inversions: how = "barrier: needs the whole list"; break;
+            case StageKind::Unknown:    how = "unknown command"; break;
+            default:
+                if (backend == Backend::Columnar) {
+                    how = "fused: one SIMD kernel per stage over the column";
+                    break;
+                }
+                bool fromSource = i > 0 && (plan[i - 1].stages.front().kind == StageKind::Load ||
+                                            plan[i - 1].stages.front().kind == StageKind::Manual);
+                how = "fused: one pass, " + std::string(fromSource ? "feeds from the source, builds only the survivors"
+                                                                    : "in place, no intermediate list");
+                break;
+        }
+        std::cout << "  [" << (i + 1) << "] " << std::left << std::setw(40) << stages << std::right << " " << how << "\n";
+    }
+}
+
+int main(int argc, char** argv) {
     ds::LinkedListStorage<int> data;
+    ds::columnar::Column<std::int32_t> column;   // holds the data instead of `data` in columnar mode
+    Backend backend = Backend::List;
+    for (int i = 1; i < argc; ++i) {
+        if (std::string_view(argv[i]) == "--columnar") backend = Backend::Columnar;
+    }
     bool running = true;
 
     std::cout << "===================================================\n";
@@ -42,10 +443,15 @@ int main() {
     std::cout << "  map + <val>         : Add val to all\n";
     std::cout << "  sort asc            : Sort ascending\n";
     std::cout << "  sort desc           : Sort descending\n";
+    std::cout << "  top <k> [asc|desc]  : Keep the k largest (desc) or smallest (asc), in order\n";
     std::cout << "  count               : Show count of elements\n";
     std::cout << "  show                : Print current list\n";
     std::cout << "  sum                 : Calculate sum\n";
+    std::cout << "  min / max           : Smallest / largest element\n";
     std::cout << "  inversions          : Count inversions\n";
+    std::cout << "  explain <pipeline>  : Show the fused plan without running it\n";
+    std::cout << "  profile <pipeline>  : Run, then show time/elements/allocations per stage\n";
+    std::cout << "  mode columnar|list  : Switch backend (start with --columnar)\n";
     std::cout << "  exit                : Quit\n";
     std::cout << "Example: manual 5 1 10 2 | filter > 3 | map * 2 | sort asc | show\n";
     std::cout << "---------------------------------------------------\n";
@@ -56,87 +462,113 @@ int main() {
         if (!std::getline(std::cin, line)) break;
         if (line == "exit") break;
 
-        auto commands = split(line, '|');
-        
-        for (const auto& cmdStr : commands) {
-            std::stringstream ss(cmdStr);
-            std::string action;
-            ss >> action;
-
-            if (action == "load") {
-                std::string fname;
-                ss >> fname;
-                auto rawWords = utils::FileHandler::readWords(fname);
-                // Parse ints
-                ds::LinkedListStorage<int> newData = ds::map(rawWords, [](const std::string& s) {
-                    try { return std::stoi(s); } catch(...) { return 0; }
-                });
-                // Append to current data or replace? Let's replace for "load", append is easy to change.
-                data = newData; 
-                std::cout << "[Loaded " << data.size() << " items]\n";
-
-            } else if (action == "manual") {
-                int val;
-                ds::LinkedListStorage<int> newData;
-                while (ss >> val) newData.push_back(val);
-                data = newData;
-                std::cout << "[Loaded " << data.size() << " items manually]\n";
-
-            } else if (action == "filter") {
-                std::string op;
-                int val;
-                ss >> op >> val;
-                if (op == ">") {
-                    data = ds::filter(data, [=](int x) { return x > val; });
-                } else if (op == "<") {
-                    data = ds::filter(data, [=](int x) { return x < val; });
-                } else if (op == "==") {
-                    data = ds::filter(data, [=](int x) { return x == val; });
-                }
-                std::cout << "[Filtered -> " << data.size() << " items]\n";
-
-            } else if (action == "map") {
-                std::string op;
-                int val;
-                ss >> op >> val;
-                if (op == "*") {
-                    data = ds::map(data, [=](int x) { return x * val; });
-                } else if (op == "+") {
-                    data = ds::map(data, [=](int x) { return x + val; });
-                } else if (op == "-") {
-                    data = ds::map(data, [=](int x) { return x - val; });
-                }
-                std::cout << "[Mapped]\n";
+        // "mode columnar|list" moves the current data to the other backend.
+        if (line.rfind("mode", 0) == 0) {
+            std::stringstream ss(line.substr(4));
+            std::string which;
+            ss >> which;
+            if (which == "columnar" && backend == Backend::List) {
+                column.assign(data.begin(), data.end());
+                data = ds::LinkedListStorage<int>{};
+                backend = Backend::Columnar;
+            } else if (which == "list" && backend == Backend::Columnar) {
+                data = ds::collect<ds::LinkedListStorage<int>>(column);
+                column = ds::columnar::Column<std::int32_t>{};
+                backend = Backend::List;
+            } else if (which != "columnar" && which != "list") {
+                std::cout << "Unknown mode: " << which << "\n";
+                continue;
+            }
+            std::cout << "[Backend: " << (backend == Backend::Columnar ? "columnar" : "list") << "]\n";
+            continue;
+        }
 
-            } else if (action == "sort") {
-                std::string order;
-                ss >> order;
-                if (order == "desc") {
-                    data = ds::sort(data, std::greater<int>{});
-                } else {
-                    data = ds::sort(data); // Default asc
-                }
-                std::cout << "[Sorted]\n";
+        // "explain <pipeline>" prints the plan instead of running it;
+        // "profile <pipeline>" runs it and then prints per-stage measurements.
+        bool explainOnly = line.rfind("explain", 0) == 0;
+        if (explainOnly) line.erase(0, 7);
+        bool profile = line.rfind("profile", 0) == 0;
+        if (profile) line.erase(0, 7);
+
+        auto plan = buildPlan(split(line, '|'));
+        if (explainOnly) {
+            explainPlan(plan, backend);
+            continue;
+        }
+        Profiler profiler(profile);
+        if (backend == Backend::Columnar) {
+            runColumnar(plan, column, profiler);
+            profiler.print();
+            continue;
+        }
+
+        std::vector<int> incoming;   // values from a source step, not yet in `data`
+        bool pendingSource = false;
+        for (const auto& step : plan) {
+            const Stage& stage = step.stages.front();
+            profiler.begin(pendingSource ? incoming.size() : data.size());
+            if (step.fused) {
+                auto results = pendingSource ? runFused(incoming, data, step.stages) : runFused(data, step.stages);
+                pendingSource = false;
+                profiler.end(step, results, data.size());
+                continue;
+            }
+            if (stage.kind == StageKind::Top && stage.val < 1) {
+                std::cout << "Usage: top <k> [asc|desc]\n";
+                profiler.end(step, {}, pendingSource ? incoming.size() : data.size());
+                continue;
+            }
+            if (stage.kind == StageKind::Top) {
+                // Reads the source values directly when there are any: only the k winners become a list.
+                std::size_t k = static_cast<std::size_t>(stage.val);
+                auto top = [&](const auto& input) {
+                    if (stage.arg == "asc") return ds::topK(ds::par, input, k, std::less<int>{});
+                    return ds::topK(ds::par, input, k, std::greater<int>{});
+                };
+                data = pendingSource ? top(incoming) : top(data);
+                pendingSource = false;
+                std::cout << "[Top " << data.size() << "]\n";
+                profiler.end(step, {}, data.size());
+                continue;
+            }
+            if (pendingSource) {
+                data = ds::collect<ds::LinkedListStorage<int>>(incoming);
+                pendingSource = false;
+            }
 
-            } else if (action == "show") {
-                std::cout << "Data: ";
-                ds::forEach(data, [](int x) { std::cout << x << " "; });
-                std::cout << "\n";
+            if (stage.kind == StageKind::Load) {
+                // Integers are parsed straight out of the mapped file; bad tokens are skipped and counted.
+                auto loaded = utils::FileHandler::readIntegers<int>(stage.arg);
+                // Replaces the current data; a following fused step consumes it before it becomes a list.
+                incoming = std::move(loaded.values);
+                pendingSource = true;
+                std::cout << "[Loaded " << incoming.size() << " items";
+                if (loaded.malformed) std::cout << ", skipped " << loaded.malformed << " malformed tokens";
+                std::cout << "]\n";
 
-            } else if (action == "count") {
-                std::cout << "Count: " << data.size() << "\n";
+            } else if (stage.kind == StageKind::Manual) {
+                incoming = stage.values;
+                pendingSource = true;
+                std::cout << "[Loaded " << incoming.size() << " items manually]\n";
 
-            } else if (action == "sum") {
-                long long sum = ds::reduce(data, 0LL, [](long long acc, int x) { return acc + x; });
-                std::cout << "Sum: " << sum << "\n";
+            } else if (stage.kind == StageKind::Sort) {
+                if (stage.arg == "desc") {
+                    data = ds::sort(std::move(data), std::greater<int>{});
+                } else {
+                    data = ds::sort(std::move(data)); // Default asc
+                }
+                std::cout << "[Sorted]\n";
 
-            } else if (action == "inversions") {
-                 long long inv = ds::countInversions(data);
+            } else if (stage.kind == StageKind::Inversions) {
+                 long long inv = ds::countInversions(ds::par, data);
                  std::cout << "Inversions: " << inv << "\n";
             } else {
-                std::cout << "Unknown command: " << action << "\n";
+                std::cout << "Unknown command: " << stage.arg << "\n";
             }
+            profiler.end(step, {}, pendingSource ? incoming.size() : data.size());
         }
+        if (pendingSource) data = ds::collect<ds::LinkedListStorage<int>>(incoming);
+        profiler.print();
     }
 
     std::cout << "Goodbye.\n";
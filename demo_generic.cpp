@@ -3,6 +3,7 @@
 #include <list>
 #include "ds/storage/LinkedListStorage.hpp"
 #include "ds/algorithms.hpp"
+#include "ds/views.hpp"
 
 int main() {
     std::cout << "--- Generic Functional Algorithms Demo ---\n\n";
@@ -44,7 +45,15 @@ int main() {
 
     std::cout << "Chained (Vector -> Filter -> Map): ";
     ds::forEach(result, [](int x) { std::cout << x << " "; });
-    std::cout << "\n";
+    std::cout << "\n\n";
+
+    // 5. Lazy Views
+    // Same chain, but nothing is allocated until a terminal op (reduce) pulls the values
+    auto lazy = mixed
+        | ds::views::filter([](int x) { return x % 2 == 0; })
+        | ds::views::map([](int x) { return x * x; });
+    int lazySum = ds::reduce(lazy, 0, [](int acc, int x) { return acc + x; });
+    std::cout << "Lazy (Vector | filter | map) summed: " << lazySum << "\n";
 
     return 0;
 }
@@ -8,3 +8,8 @@
 #include "algorithms/FlatMap.hpp"
 #include "algorithms/Sort.hpp"
 #include "algorithms/CountInversions.hpp"
+#include "algorithms/Collect.hpp"
+#include "algorithms/CountBy.hpp"
+#include "algorithms/GroupBy.hpp"
+#include "algorithms/TopK.hpp"
+#include "algorithms/Parallel.hpp"
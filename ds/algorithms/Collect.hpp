@@ -0,0 +1,48 @@
+#pragma once
+#include <type_traits>
+#include <utility>
+#include "../concepts.hpp"
+
+namespace ds {
+
+namespace internal {
+    // Result storage for algorithms with an optional Out parameter: Out, or Default when Out is void.
+    template <typename Out, typename Default>
+    using ResultStorage = std::conditional_t<std::is_void_v<Out>, Default, Out>;
+
+    template <typename Out, typename Container>
+    void reserveFor(Out& out, const Container& input) {
+        if constexpr (Reservable<Out> && Sized<Container>) {
+            out.reserve(input.size());
+        }
+    }
+
+    // Moves every element of src onto the back of dst, relinking nodes when dst can splice.
+    template <typename Dst, typename Src>
+    void appendAll(Dst& dst, Src&& src) {
+        if constexpr (std::is_same_v<Dst, std::remove_cvref_t<Src>> &&
+                      requires { dst.splice_back(std::move(src)); }) {
+            dst.splice_back(std::move(src));
+        } else {
+            for (auto& subItem : src) {
+                dst.push_back(std::move(subItem));
+            }
+        }
+    }
+}
+
+/**
+ * Collect: Copies every element of any iterable into a new Out storage (in order).
+ * Out only needs push_back; capacity is reserved up front when both sides allow it.
+ */
+template <typename Out, typename Container>
+Out collect(const Container& input) {
+    Out result;
+    internal::reserveFor(result, input);
+    for (const auto& item : input) {
+        result.push_back(item);
+    }
+    return result;
+}
+
+} // namespace ds
@@ -0,0 +1,30 @@
+#pragma once
+#include "../storage/HashMapStorage.hpp"
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+namespace ds {
+
+namespace internal {
+    template <typename Container, typename KeyFunc>
+    using GroupKey = std::remove_cvref_t<std::invoke_result_t<KeyFunc&, const typename Container::value_type&>>;
+}
+
+/**
+ * Count By: Counts the elements of any container per key in a single pass.
+ * The key defaults to the element itself, so ds::countBy(words) is a word-frequency table.
+ * Returns a HashMapStorage<Key, size_t>; each lookup is O(1) expected.
+ * Time Complexity: O(N) expected
+ */
+template <typename Container, typename KeyFunc = std::identity>
+auto countBy(const Container& input, KeyFunc key = KeyFunc{})
+    -> HashMapStorage<internal::GroupKey<Container, KeyFunc>, std::size_t> {
+    HashMapStorage<internal::GroupKey<Container, KeyFunc>, std::size_t> counts;
+    for (const auto& item : input) {
+        ++counts[key(item)];
+    }
+    return counts;
+}
+
+} // namespace ds
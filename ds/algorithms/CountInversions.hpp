@@ -1,73 +1,130 @@
 #pragma once
 #include "../storage/LinkedListStorage.hpp"
+#include "../concepts.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
 #include <vector>
-#include <iterator>
 
 namespace ds {
 
 namespace internal {
-    // Helper to merge and count split inversions
+    // Merges sorted src[lo, mid) and src[mid, hi) into dst[lo, hi), returning split inversions.
     template <typename T, typename Comparator>
-    long long mergeAndCount(std::vector<T>& vec, int left, int mid, int right, Comparator cmp) {
-        std::vector<T> leftSub(vec.begin() + left, vec.begin() + mid + 1);
-        std::vector<T> rightSub(vec.begin() + mid + 1, vec.begin() + right + 1);
-
-        size_t i = 0;
-        size_t j = 0;
-        int k = left;
+    long long mergeAndCount(const T* src, T* dst, std::size_t lo, std::size_t mid, std::size_t hi, Comparator& cmp) {
+        std::size_t i = lo;
+        std::size_t j = mid;
+        std::size_t k = lo;
         long long inversions = 0;
 
-        while (i < leftSub.size() && j < rightSub.size()) {
-            if (cmp(rightSub[j], leftSub[i])) {
-                // right element is smaller (or whatever cmp defines as "inversion" context)
-                // If we are sorting ascendingly (cmp = less), and right < left, it's an inversion.
-                // Inversions are all remaining elements in left subarray
-                vec[k++] = rightSub[j++];
-                inversions += (leftSub.size() - i);
+        while (i < mid && j < hi) {
+            if (cmp(src[j], src[i])) {
+                // Right element precedes every remaining left element: each pair is an inversion.
+                inversions += static_cast<long long>(mid - i);
+                dst[k++] = src[j++];
             } else {
-                vec[k++] = leftSub[i++];
+                dst[k++] = src[i++];
             }
         }
-
-        while (i < leftSub.size()) vec[k++] = leftSub[i++];
-        while (j < rightSub.size()) vec[k++] = rightSub[j++];
+        while (i < mid) dst[k++] = src[i++];
+        while (j < hi) dst[k++] = src[j++];
 
         return inversions;
     }
 
+    /**
+     * Bottom-up merge count over vec[lo, hi): runs of width 1, 2, 4, ... are merged
+     * back and forth between vec and scratch (same size as vec, preallocated once).
+     * On return vec[lo, hi) is sorted.
+     */
     template <typename T, typename Comparator>
-    long long sortAndCount(std::vector<T>& vec, int left, int right, Comparator cmp) {
-        if (left >= right) return 0;
-
-        int mid = left + (right - left) / 2;
+    long long sortAndCount(std::vector<T>& vec, std::vector<T>& scratch, std::size_t lo, std::size_t hi, Comparator& cmp) {
         long long count = 0;
+        T* src = vec.data();
+        T* dst = scratch.data();
+        for (std::size_t width = 1; width < hi - lo; width *= 2) {
+            for (std::size_t left = lo; left < hi; left += 2 * width) {
+                std::size_t mid = std::min(left + width, hi);
+                std::size_t right = std::min(left + 2 * width, hi);
+                count += mergeAndCount(src, dst, left, mid, right, cmp);
+            }
+            std::swap(src, dst);
+        }
+        if (src != vec.data()) std::copy(src + lo, src + hi, vec.data() + lo);
+        return count;
+    }
+
+    template <typename T, typename Comparator>
+    constexpr int fenwickDirection() {
+        if constexpr (!std::is_integral_v<T> || std::is_same_v<T, bool>) return 0;
+        else if constexpr (std::is_same_v<Comparator, std::less<T>> || std::is_same_v<Comparator, std::less<>>) return 1;
+        else if constexpr (std::is_same_v<Comparator, std::greater<T>> || std::is_same_v<Comparator, std::greater<>>) return -1;
+        else return 0;
+    }
 
-        count += sortAndCount(vec, left, mid, cmp);
-        count += sortAndCount(vec, mid + 1, right, cmp);
-        count += mergeAndCount(vec, left, mid, right, cmp);
+    /**
+     * Fenwick-tree count for integers under std::less / std::greater: O(N log V) for a
+     * value range V, with no element movement. Each element adds the number of earlier
+     * elements it must precede. Returns false (and leaves count alone) when the range is
+     * too wide for a table of about max(N, 2^16) counters.
+     */
+    template <typename T, typename Comparator>
+    bool fenwickCount(const std::vector<T>& vec, long long& count) {
+        constexpr int dir = fenwickDirection<T, Comparator>();
+        if constexpr (dir == 0) {
+            return false;
+        } else {
+            using U = std::make_unsigned_t<T>;
+            auto [lo, hi] = std::minmax_element(vec.begin(), vec.end());
+            U range = static_cast<U>(static_cast<U>(*hi) - static_cast<U>(*lo));
+            std::size_t limit = std::max<std::size_t>(vec.size(), std::size_t{1} << 16);
+            if (range >= limit) return false;
 
-        return count;
+            std::size_t size = static_cast<std::size_t>(range) + 1;
+            std::vector<std::size_t> tree(size + 1, 0);
+            U base = static_cast<U>(*lo);
+            long long total = 0;
+            for (std::size_t seen = 0; seen < vec.size(); ++seen) {
+                std::size_t rank = static_cast<std::size_t>(static_cast<U>(static_cast<U>(vec[seen]) - base));
+                if (dir < 0) rank = size - 1 - rank;   // greater-than order: mirror the ranks
+                // Earlier elements with rank <= this one are not inversions.
+                std::size_t notInverted = 0;
+                for (std::size_t i = rank + 1; i > 0; i -= i & (~i + 1)) notInverted += tree[i];
+                total += static_cast<long long>(seen - notInverted);
+                for (std::size_t i = rank + 1; i <= size; i += i & (~i + 1)) ++tree[i];
+            }
+            count = total;
+            return true;
+        }
     }
 }
 
 /**
  * Count Inversions: Counts how many pairs (i, j) exist such that i < j but a[i] > a[j].
- * Uses O(N log N) Merge Sort approach.
+ * Uses an iterative O(N log N) Merge Sort with one preallocated scratch buffer.
+ * Integers compared with std::less / std::greater over a small value range take an
+ * O(N log V) Fenwick-tree path instead.
  * Note: This function copies the data into a vector for efficient indexing during the count.
  */
 template <typename Container, typename Comparator = std::less<typename Container::value_type>>
+requires Iterable<Container>
 long long countInversions(const Container& input, Comparator cmp = Comparator{}) {
     using T = typename Container::value_type;
-    
+
     // Copy to vector for random access required by efficient inversion counting
     std::vector<T> vec;
+    if constexpr (Sized<Container>) vec.reserve(input.size());
     for (const auto& item : input) {
         vec.push_back(item);
     }
 
-    if (vec.empty()) return 0;
-    return internal::sortAndCount(vec, 0, (int)vec.size() - 1, cmp);
+    if (vec.size() < 2) return 0;
+    long long count = 0;
+    if (internal::fenwickCount<T, Comparator>(vec, count)) return count;
+    std::vector<T> scratch(vec);
+    return internal::sortAndCount(vec, scratch, 0, vec.size(), cmp);
 }
 
 } // namespace ds
-
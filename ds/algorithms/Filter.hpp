@@ -1,15 +1,21 @@
 #pragma once
 #include "../storage/LinkedListStorage.hpp"
+#include "Collect.hpp"
+#include <type_traits>
+#include <utility>
 
 namespace ds {
 
 /**
  * Filter: Returns a new list containing only elements that satisfy the predicate.
+ * Pass Out to collect into another BackPushable storage: ds::filter<std::vector<int>>(input, p).
+ * No reserve here: the output size is unknown and input.size() is only an upper bound.
  */
-template <typename Container, typename Predicate>
-auto filter(const Container& input, Predicate p) -> LinkedListStorage<typename Container::value_type> {
+template <typename Out = void, typename Container, typename Predicate>
+auto filter(const Container& input, Predicate p)
+    -> internal::ResultStorage<Out, LinkedListStorage<typename Container::value_type>> {
     using T = typename Container::value_type;
-    LinkedListStorage<T> result;
+    internal::ResultStorage<Out, LinkedListStorage<T>> result;
     for (const auto& item : input) {
         if (p(item)) {
             result.push_back(item);
@@ -18,4 +24,30 @@ auto filter(const Container& input, Predicate p) -> LinkedListStorage<typename C
     return result;
 }
 
+/**
+ * Filter (consuming): Takes an rvalue container. A list that is also the result type is
+ * filtered in place by unlinking rejected nodes; otherwise survivors are moved, not copied.
+ *   data = ds::filter(std::move(data), p);   // zero element copies
+ */
+template <typename Out = void, typename Container, typename Predicate>
+requires (!std::is_lvalue_reference_v<Container> && !std::is_const_v<Container> && ds::Container<Container>)
+auto filter(Container&& input, Predicate p)
+    -> internal::ResultStorage<Out, LinkedListStorage<typename Container::value_type>> {
+    using T = typename Container::value_type;
+    using Result = internal::ResultStorage<Out, LinkedListStorage<T>>;
+    if constexpr (std::is_same_v<Result, Container> &&
+                  requires(Container& c) { c.remove_if([](const T&) { return false; }); }) {
+        input.remove_if([&](const T& item) { return !p(item); });
+        return std::move(input);
+    } else {
+        Result result;
+        for (auto& item : input) {
+            if (p(item)) {
+                result.push_back(std::move(item));
+            }
+        }
+        return result;
+    }
+}
+
 } // namespace ds
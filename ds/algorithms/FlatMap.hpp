@@ -1,5 +1,8 @@
 #pragma once
 #include "../storage/LinkedListStorage.hpp"
+#include "../concepts.hpp"
+#include "Collect.hpp"
+#include <type_traits>
 #include <utility>
 
 namespace ds {
@@ -7,18 +10,32 @@ namespace ds {
 /**
  * FlatMap: Maps each element to a list, then flattens the result.
  * Returns a LinkedListStorage of the inner type.
+ * Each sublist returned by f is spliced (or moved) into the result, never copied.
  */
 template <typename Container, typename Func>
 auto flatMap(const Container& input, Func f) -> decltype(f(std::declval<typename Container::value_type>())) {
     using T = typename Container::value_type;
     using ResultListType = decltype(f(std::declval<T>())); // Expected to be a LinkedListStorage-like
-    
+
     ResultListType result;
     for (const auto& item : input) {
-        ResultListType sublist = f(item);
-        for (const auto& subItem : sublist) {
-            result.push_back(subItem);
-        }
+        internal::appendAll(result, f(item));
+    }
+    return result;
+}
+
+/**
+ * FlatMap (consuming): Like flatMap, but hands each element of the rvalue input to f as an rvalue.
+ */
+template <typename Container, typename Func>
+requires (!std::is_lvalue_reference_v<Container> && !std::is_const_v<Container> && ds::Container<Container>)
+auto flatMap(Container&& input, Func f) -> decltype(f(std::declval<typename Container::value_type>())) {
+    using T = typename Container::value_type;
+    using ResultListType = decltype(f(std::declval<T>()));
+
+    ResultListType result;
+    for (auto& item : input) {
+        internal::appendAll(result, f(std::move(item)));
     }
     return result;
 }
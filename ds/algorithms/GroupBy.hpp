@@ -0,0 +1,46 @@
+#pragma once
+#include "../storage/HashMapStorage.hpp"
+#include "../storage/LinkedListStorage.hpp"
+#include "Collect.hpp"
+#include "CountBy.hpp"
+#include <type_traits>
+#include <utility>
+
+namespace ds {
+
+/**
+ * Group By: Buckets the elements of any container by key(item) in a single pass.
+ * Returns a HashMapStorage mapping each key to a list of its elements, in input order.
+ * Pass Out to choose the group storage: ds::groupBy<std::vector<Word>>(words, byLength).
+ * Time Complexity: O(N) expected
+ */
+template <typename Out = void, typename Container, typename KeyFunc>
+auto groupBy(const Container& input, KeyFunc key)
+    -> HashMapStorage<internal::GroupKey<Container, KeyFunc>,
+                      internal::ResultStorage<Out, LinkedListStorage<typename Container::value_type>>> {
+    using T = typename Container::value_type;
+    HashMapStorage<internal::GroupKey<Container, KeyFunc>, internal::ResultStorage<Out, LinkedListStorage<T>>> groups;
+    for (const auto& item : input) {
+        groups[key(item)].push_back(item);
+    }
+    return groups;
+}
+
+/**
+ * Group By (consuming): Takes an rvalue container and moves its elements into the groups.
+ */
+template <typename Out = void, typename Container, typename KeyFunc>
+requires (!std::is_lvalue_reference_v<Container> && !std::is_const_v<Container> && ds::Container<Container>)
+auto groupBy(Container&& input, KeyFunc key)
+    -> HashMapStorage<internal::GroupKey<Container, KeyFunc>,
+                      internal::ResultStorage<Out, LinkedListStorage<typename Container::value_type>>> {
+    using T = typename Container::value_type;
+    HashMapStorage<internal::GroupKey<Container, KeyFunc>, internal::ResultStorage<Out, LinkedListStorage<T>>> groups;
+    for (auto& item : input) {
+        auto& group = groups[key(std::as_const(item))];
+        group.push_back(std::move(item));
+    }
+    return groups;
+}
+
+} // namespace ds
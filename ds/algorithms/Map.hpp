@@ -1,5 +1,7 @@
 #pragma once
 #include "../storage/LinkedListStorage.hpp"
+#include "Collect.hpp"
+#include <type_traits>
 #include <utility>
 
 namespace ds {
@@ -7,16 +9,46 @@ namespace ds {
 /**
  * Map: Transforms a Container<T> into a LinkedListStorage<U> using a transformer function.
  * Pure function: Returns a new list, does not modify input.
+ * Pass Out to collect into another BackPushable storage: ds::map<std::vector<int>>(input, f).
  */
-template <typename Container, typename Func>
-auto map(const Container& input, Func f) -> LinkedListStorage<decltype(f(std::declval<typename Container::value_type>()))> {
+template <typename Out = void, typename Container, typename Func>
+auto map(const Container& input, Func f)
+    -> internal::ResultStorage<Out, LinkedListStorage<decltype(f(std::declval<typename Container::value_type>()))>> {
     using T = typename Container::value_type;
     using U = decltype(f(std::declval<T>()));
-    LinkedListStorage<U> result;
+    internal::ResultStorage<Out, LinkedListStorage<U>> result;
+    internal::reserveFor(result, input);
     for (const auto& item : input) {
         result.push_back(f(item));
     }
     return result;
 }
 
+/**
+ * Map (consuming): Takes an rvalue container and hands each element to f as an rvalue.
+ * When the result has the same type as the input, elements are rewritten in their
+ * existing slots, so `data = ds::map(std::move(data), f)` allocates nothing.
+ */
+template <typename Out = void, typename Container, typename Func>
+requires (!std::is_lvalue_reference_v<Container> && !std::is_const_v<Container> && ds::Container<Container>)
+auto map(Container&& input, Func f)
+    -> internal::ResultStorage<Out, LinkedListStorage<decltype(f(std::declval<typename Container::value_type>()))>> {
+    using T = typename Container::value_type;
+    using U = decltype(f(std::declval<T>()));
+    using Result = internal::ResultStorage<Out, LinkedListStorage<U>>;
+    if constexpr (std::is_same_v<Result, Container>) {
+        for (auto& item : input) {
+            item = f(std::move(item));
+        }
+        return std::move(input);
+    } else {
+        Result result;
+        internal::reserveFor(result, input);
+        for (auto& item : input) {
+            result.push_back(f(std::move(item)));
+        }
+        return result;
+    }
+}
+
 } // namespace ds
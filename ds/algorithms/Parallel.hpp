@@ -0,0 +1,334 @@
+#pragma once
+#include "../storage/LinkedListStorage.hpp"
+#include "../parallel/ExecutionPolicy.hpp"
+#include "Collect.hpp"
+#include "Map.hpp"
+#include "Filter.hpp"
+#include "Reduce.hpp"
+#include "ForEach.hpp"
+#include "Sort.hpp"
+#include "CountInversions.hpp"
+#include "TopK.hpp"
+#include <algorithm>
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ds {
+
+namespace internal {
+    template <typename It>
+    struct Chunk {
+        It first;
+        It last;
+    };
+
+    /**
+     * Splits any iterable into contiguous chunks of near-equal size without copying it.
+     * Forward-only sources (LinkedListStorage, Stack, Queue, ...) are walked once to record
+     * the chunk boundaries; unsized sources are counted first.
+     */
+    template <typename Container, typename Policy>
+    auto splitChunks(const Container& input, const Policy& policy) {
+        using It = decltype(input.begin());
+        std::vector<Chunk<It>> chunks;
+
+        std::size_t n = 0;
+        if constexpr (Sized<Container>) {
+            n = input.size();
+        } else {
+            for (It it = input.begin(); it != input.end(); ++it) ++n;
+        }
+        if (n == 0) return chunks;
+
+        // A few chunks per thread so stealing can even out uneven work.
+        std::size_t maxChunks = policy.executor().size() * 4;
+        std::size_t count = std::clamp<std::size_t>(n / policy.grain, 1, maxChunks);
+        std::size_t base = n / count;
+        std::size_t extra = n % count;
+
+        chunks.reserve(count);
+        It it = input.begin();
+        for (std::size_t c = 0; c < count; ++c) {
+            It first = it;
+            std::advance(it, base + (c < extra ? 1 : 0));
+            chunks.push_back({first, it});
+        }
+        return chunks;
+    }
+
+    // Concatenates per-chunk results in chunk order.
+    template <typename Result>
+    Result joinParts(std::vector<Result>& parts) {
+        Result out = std::move(parts.front());
+        if constexpr (Reservable<Result> && Sized<Result>) {
+            std::size_t total = 0;
+            for (const auto& part : parts) total += part.size();
+            out.reserve(total);
+        }
+        for (std::size_t i = 1; i < parts.size(); ++i) {
+            appendAll(out, std::move(parts[i]));
+        }
+        return out;
+    }
+}
+
+/**
+ * Parallel Map: Each chunk is mapped into its own result on the pool; the parts are then
+ * spliced together in order, so the output order matches the serial ds::map.
+ * f must be safe to call concurrently.
+ */
+template <typename Out = void, ExecutionPolicy Policy, typename Container, typename Func>
+auto map(const Policy& policy, const Container& input, Func f)
+    -> internal::ResultStorage<Out, LinkedListStorage<decltype(f(std::declval<typename Container::value_type>()))>> {
+    using T = typename Container::value_type;
+    using Result = internal::ResultStorage<Out, LinkedListStorage<decltype(f(std::declval<T>()))>>;
+    if constexpr (!ParallelPolicy<Policy>) {
+        return map<Out>(input, f);
+    } else {
+        auto chunks = internal::splitChunks(input, policy);
+        if (chunks.size() <= 1) return map<Out>(input, f);
+
+        std::vector<Result> parts(chunks.size());
+        policy.executor().run(chunks.size(), [&](std::size_t c) {
+            for (auto it = chunks[c].first; it != chunks[c].last; ++it) {
+                parts[c].push_back(f(*it));
+            }
+        });
+        return internal::joinParts(parts);
+    }
+}
+
+/**
+ * Parallel Filter: Chunks are filtered independently and joined in order (stable).
+ */
+template <typename Out = void, ExecutionPolicy Policy, typename Container, typename Predicate>
+auto filter(const Policy& policy, const Container& input, Predicate p)
+    -> internal::ResultStorage<Out, LinkedListStorage<typename Container::value_type>> {
+    using T = typename Container::value_type;
+    using Result = internal::ResultStorage<Out, LinkedListStorage<T>>;
+    if constexpr (!ParallelPolicy<Policy>) {
+        return filter<Out>(input, p);
+    } else {
+        auto chunks = internal::splitChunks(input, policy);
+        if (chunks.size() <= 1) return filter<Out>(input, p);
+
+        std::vector<Result> parts(chunks.size());
+        policy.executor().run(chunks.size(), [&](std::size_t c) {
+            for (auto it = chunks[c].first; it != chunks[c].last; ++it) {
+                if (p(*it)) parts[c].push_back(*it);
+            }
+        });
+        return internal::joinParts(parts);
+    }
+}
+
+/**
+ * Parallel Reduce: op must be an associative T x T -> T operation (sum, max, ...), with U = T.
+ * Each chunk folds its elements starting from its first element, and the partials are then
+ * folded onto `initial` in chunk order, so an op that treats its two arguments differently
+ * (e.g. counting: acc + (x > 0)) gives a different result than the serial fold. Use the
+ * (identity, op, combine) overload below for those.
+ */
+template <ExecutionPolicy Policy, typename Container, typename U, typename BinaryOp>
+U reduce(const Policy& policy, const Container& input, U initial, BinaryOp op) {
+    if constexpr (!ParallelPolicy<Policy>) {
+        return reduce(input, initial, op);
+    } else {
+        static_assert(std::same_as<U, typename Container::value_type> && std::is_invocable_r_v<U, BinaryOp, U, U>,
+                      "parallel reduce(policy, input, initial, op) needs op: (T, T) -> T with U = T; "
+                      "use reduce(policy, input, identity, op, combine) for other accumulators");
+        auto chunks = internal::splitChunks(input, policy);
+        if (chunks.size() <= 1) return reduce(input, initial, op);
+
+        std::vector<std::optional<U>> partials(chunks.size());
+        policy.executor().run(chunks.size(), [&](std::size_t c) {
+            auto it = chunks[c].first;
+            U acc = U(*it);
+            for (++it; it != chunks[c].last; ++it) acc = op(acc, *it);
+            partials[c] = std::move(acc);
+        });
+        U accumulator = initial;
+        for (auto& partial : partials) accumulator = op(accumulator, *partial);
+        return accumulator;
+    }
+}
+
+/**
+ * Parallel Reduce with a separate combiner: each chunk folds from `identity` with op,
+ * and chunk results are merged with combine. Use it when element and accumulator types
+ * differ, e.g. counting matches: reduce(par, words, 0, countOp, std::plus<>{}).
+ */
+template <ExecutionPolicy Policy, typename Container, typename U, typename BinaryOp, typename Combine>
+U reduce(const Policy& policy, const Container& input, U identity, BinaryOp op, Combine combine) {
+    if constexpr (!ParallelPolicy<Policy>) {
+        return reduce(input, identity, op);
+    } else {
+        auto chunks = internal::splitChunks(input, policy);
+        if (chunks.size() <= 1) return reduce(input, identity, op);
+
+        std::vector<std::optional<U>> partials(chunks.size());
+        policy.executor().run(chunks.size(), [&](std::size_t c) {
+            U acc = identity;
+            for (auto it = chunks[c].first; it != chunks[c].last; ++it) acc = op(acc, *it);
+            partials[c] = std::move(acc);
+        });
+        U accumulator = std::move(*partials.front());
+        for (std::size_t c = 1; c < partials.size(); ++c) accumulator = combine(accumulator, *partials[c]);
+        return accumulator;
+    }
+}
+
+/**
+ * Parallel ForEach: f runs concurrently on different chunks; call order is unspecified.
+ */
+template <ExecutionPolicy Policy, typename Container, typename Func>
+void forEach(const Policy& policy, const Container& input, Func f) {
+    if constexpr (!ParallelPolicy<Policy>) {
+        forEach(input, f);
+    } else {
+        auto chunks = internal::splitChunks(input, policy);
+        if (chunks.size() <= 1) { forEach(input, f); return; }
+
+        policy.executor().run(chunks.size(), [&](std::size_t c) {
+            for (auto it = chunks[c].first; it != chunks[c].last; ++it) f(*it);
+        });
+    }
+}
+
+/**
+ * Parallel Sort: Chunks are copied into their own lists and sorted in place concurrently,
+ * then merged pairwise by relinking, one parallel round per doubling. Stable.
+ */
+template <ExecutionPolicy Policy, typename Container, typename Comparator = std::less<typename Container::value_type>>
+auto sort(const Policy& policy, const Container& input, Comparator cmp = Comparator{})
+    -> LinkedListStorage<typename Container::value_type> {
+    using T = typename Container::value_type;
+    if constexpr (!ParallelPolicy<Policy>) {
+        return sort(input, cmp);
+    } else {
+        auto chunks = internal::splitChunks(input, policy);
+        if (chunks.size() <= 1) return sort(input, cmp);
+
+        std::vector<LinkedListStorage<T>> runs(chunks.size());
+        ThreadPool& pool = policy.executor();
+        pool.run(chunks.size(), [&](std::size_t c) {
+            for (auto it = chunks[c].first; it != chunks[c].last; ++it) runs[c].push_back(*it);
+            runs[c].sort(cmp);
+        });
+        for (std::size_t width = 1; width < runs.size(); width *= 2) {
+            std::size_t pairs = (runs.size() + 2 * width - 1) / (2 * width);
+            pool.run(pairs, [&](std::size_t i) {
+                std::size_t left = 2 * width * i;
+                if (left + width < runs.size()) runs[left].merge(std::move(runs[left + width]), cmp);
+            });
+        }
+        return std::move(runs.front());
+    }
+}
+
+/**
+ * Parallel Count Inversions: Independent runs are merge-counted concurrently, then
+ * adjacent runs are merge-counted pairwise, one parallel round per doubling, ping-ponging
+ * between the data and a single scratch buffer. The Fenwick path is used when it applies.
+ */
+template <ExecutionPolicy Policy, typename Container, typename Comparator = std::less<typename Container::value_type>>
+long long countInversions(const Policy& policy, const Container& input, Comparator cmp = Comparator{}) {
+    using T = typename Container::value_type;
+    if constexpr (!ParallelPolicy<Policy>) {
+        return countInversions(input, cmp);
+    } else {
+        auto chunks = internal::splitChunks(input, policy);
+        if (chunks.size() <= 1) return countInversions(input, cmp);
+
+        // Copy each chunk to its slot; chunk c occupies [bounds[c], bounds[c + 1]).
+        std::vector<std::size_t> bounds(chunks.size() + 1, 0);
+        for (std::size_t c = 0; c < chunks.size(); ++c) {
+            bounds[c + 1] = bounds[c] + static_cast<std::size_t>(std::distance(chunks[c].first, chunks[c].last));
+        }
+        std::vector<T> vec;
+        vec.reserve(bounds.back());
+        for (const auto& item : input) vec.push_back(item);
+
+        long long count = 0;
+        if (internal::fenwickCount<T, Comparator>(vec, count)) return count;
+
+        ThreadPool& pool = policy.executor();
+        std::vector<T> scratch(vec);
+        std::vector<long long> partial(chunks.size(), 0);
+        pool.run(chunks.size(), [&](std::size_t c) {
+            Comparator local = cmp;
+            partial[c] = internal::sortAndCount(vec, scratch, bounds[c], bounds[c + 1], local);
+        });
+
+        std::size_t runs = chunks.size();
+        T* src = vec.data();
+        T* dst = scratch.data();
+        for (std::size_t width = 1; width < runs; width *= 2) {
+            std::size_t pairs = (runs + 2 * width - 1) / (2 * width);
+            std::vector<long long> round(pairs, 0);
+            pool.run(pairs, [&](std::size_t i) {
+                Comparator local = cmp;
+                std::size_t left = 2 * width * i;
+                std::size_t lo = bounds[left];
+                std::size_t mid = bounds[std::min(left + width, runs)];
+                std::size_t hi = bounds[std::min(left + 2 * width, runs)];
+                round[i] = internal::mergeAndCount(src, dst, lo, mid, hi, local);
+            });
+            for (long long r : round) count += r;
+            std::swap(src, dst);
+        }
+        for (long long p : partial) count += p;
+        return count;
+    }
+}
+
+/**
+ * Parallel TopK: Every chunk fills its own bounded heap of k (tagged with global positions),
+ * then the at most k winners per chunk are merged into one final heap. Same result as the
+ * serial topK, ties included.
+ */
+template <typename Out = void, ExecutionPolicy Policy, typename Container,
+          typename Comparator = std::less<typename Container::value_type>>
+auto topK(const Policy& policy, const Container& input, std::size_t k, Comparator cmp = Comparator{})
+    -> internal::ResultStorage<Out, LinkedListStorage<typename Container::value_type>> {
+    using T = typename Container::value_type;
+    using Result = internal::ResultStorage<Out, LinkedListStorage<T>>;
+    using Heap = internal::TopKHeap<T, Comparator>;
+    if constexpr (!ParallelPolicy<Policy>) {
+        return topK<Out>(input, k, cmp);
+    } else {
+        auto chunks = internal::splitChunks(input, policy);
+        if (chunks.size() <= 1) return topK<Out>(input, k, cmp);
+
+        std::vector<std::size_t> offsets(chunks.size() + 1, 0);
+        for (std::size_t c = 0; c < chunks.size(); ++c) {
+            offsets[c + 1] = offsets[c] + static_cast<std::size_t>(std::distance(chunks[c].first, chunks[c].last));
+        }
+        // Per-chunk heaps only pay off while they discard most of their chunk; with a large k
+        // every chunk keeps (and the merge re-offers) nearly everything, so stay serial.
+        if (k * chunks.size() * 64 > offsets.back()) return topK<Out>(input, k, cmp);
+
+        std::vector<std::vector<typename Heap::Entry>> winners(chunks.size());
+        policy.executor().run(chunks.size(), [&](std::size_t c) {
+            Heap heap(k, cmp, offsets[c + 1] - offsets[c]);
+            std::size_t index = offsets[c];
+            for (auto it = chunks[c].first; it != chunks[c].last; ++it) heap.offer(*it, index++);
+            winners[c] = heap.drain();
+        });
+
+        std::size_t candidates = 0;
+        for (const auto& w : winners) candidates += w.size();
+        Heap merged(k, cmp, candidates);
+        for (auto& w : winners) {
+            for (auto& entry : w) merged.offer(std::move(entry));
+        }
+        return internal::collectTopK<Result>(merged);
+    }
+}
+
+} // namespace ds
@@ -1,65 +1,89 @@
 #pragma once
 #include "../storage/LinkedListStorage.hpp"
+#include "Collect.hpp"
+#include <algorithm>
 #include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
 
 namespace ds {
 
 namespace internal {
-    // Helper to merge two sorted lists
-    template <typename T, typename Comparator>
-    LinkedListStorage<T> merge(const LinkedListStorage<T>& left, const LinkedListStorage<T>& right, Comparator cmp) {
-        LinkedListStorage<T> result;
-        auto itL = left.begin();
-        auto itR = right.begin();
-        
-        while (itL != left.end() && itR != right.end()) {
-            if (cmp(*itL, *itR)) {
-                result.push_back(*itL);
-                ++itL;
-            } else {
-                result.push_back(*itR);
-                ++itR;
-            }
-        }
-        while (itL != left.end()) { result.push_back(*itL); ++itL; }
-        while (itR != right.end()) { result.push_back(*itR); ++itR; }
-        return result;
+    template <typename S, typename Comparator>
+    concept MemberSortable = requires(S& s, Comparator cmp) { s.sort(cmp); };
+}
+
+/**
+ * Sort In Place: Stably sorts a container without building a new one.
+ * Lists (LinkedListStorage, std::list) are relinked node by node with O(1) extra memory;
+ * random-access containers use std::stable_sort.
+ */
+template <typename Container, typename Comparator = std::less<typename Container::value_type>>
+void sort_inplace(Container& data, Comparator cmp = Comparator{}) {
+    if constexpr (internal::MemberSortable<Container, Comparator>) {
+        data.sort(cmp);
+    } else {
+        static_assert(std::random_access_iterator<decltype(data.begin())>,
+                      "sort_inplace needs a member sort(cmp) or random-access iterators");
+        std::stable_sort(data.begin(), data.end(), cmp);
     }
 }
 
 /**
  * Sort: Returns a NEW sorted list using Merge Sort.
  * Can accept ANY container, but returns a LinkedListStorage<T> to ensure order.
+ * The input is copied once into the result, which is then sorted in place (stable).
  * Time Complexity: O(N log N)
  */
-template <typename Container, typename Comparator = std::less<typename Container::value_type>>
+template <typename Out = void, typename Container, typename Comparator = std::less<typename Container::value_type>>
+requires std::is_void_v<Out>
 auto sort(const Container& input, Comparator cmp = Comparator{}) -> LinkedListStorage<typename Container::value_type> {
     using T = typename Container::value_type;
-    
-    // Convert input container to LinkedListStorage if it isn't one already,
-    // because our merge sort implementation relies on splitting linked lists.
-    LinkedListStorage<T> listInput;
-    for(const auto& item : input) {
-        listInput.push_back(item);
-    }
-
-    if (listInput.size() <= 1) return listInput;
+    LinkedListStorage<T> result = collect<LinkedListStorage<T>>(input);
+    result.sort(cmp);
+    return result;
+}
 
-    // Split
-    LinkedListStorage<T> left;
-    LinkedListStorage<T> right;
-    std::size_t mid = listInput.size() / 2;
-    std::size_t i = 0;
-    
-    for (const auto& item : listInput) {
-        if (i < mid) left.push_back(item);
-        else right.push_back(item);
-        i++;
+/**
+ * Sort (consuming): An rvalue list is sorted by relinking its own nodes and handed back;
+ * any other rvalue container has its elements moved into the result list first.
+ *   data = ds::sort(std::move(data));   // no allocation, no element copies
+ */
+template <typename Out = void, typename Container, typename Comparator = std::less<typename Container::value_type>>
+requires (std::is_void_v<Out> && !std::is_lvalue_reference_v<Container> && !std::is_const_v<Container> &&
+          ds::Container<Container>)
+auto sort(Container&& input, Comparator cmp = Comparator{}) -> LinkedListStorage<typename Container::value_type> {
+    using T = typename Container::value_type;
+    if constexpr (std::is_same_v<Container, LinkedListStorage<T>>) {
+        input.sort(cmp);
+        return std::move(input);
+    } else {
+        LinkedListStorage<T> result;
+        for (auto& item : input) {
+            result.push_back(std::move(item));
+        }
+        result.sort(cmp);
+        return result;
     }
+}
 
-    // Recurse (Note: Recursive calls will use the LinkedListStorage overload implicitly if we had one, 
-    // but since we made this generic, it works recursively too)
-    return internal::merge(sort(left, cmp), sort(right, cmp), cmp);
+/**
+ * Sort into a caller-chosen storage: ds::sort<std::vector<int>>(input, cmp).
+ * The input is collected into Out once (reserved when sizes are known) and sorted there:
+ * random-access outputs with std::stable_sort, lists by relinking.
+ */
+template <typename Out, typename Container, typename Comparator = std::less<typename Container::value_type>>
+requires (!std::is_void_v<Out>)
+Out sort(const Container& input, Comparator cmp = Comparator{}) {
+    if constexpr (internal::MemberSortable<Out, Comparator> ||
+                  std::random_access_iterator<decltype(std::declval<Out&>().begin())>) {
+        Out result = collect<Out>(input);
+        sort_inplace(result, cmp);
+        return result;
+    } else {
+        return collect<Out>(sort(input, cmp));
+    }
 }
 
 } // namespace ds
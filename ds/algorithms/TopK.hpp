@@ -0,0 +1,144 @@
+#pragma once
+#include "../storage/LinkedListStorage.hpp"
+#include "../storage/VectorHeapStorage.hpp"
+#include "../concepts.hpp"
+#include "Collect.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ds {
+
+namespace internal {
+    /**
+     * Bounded heap holding the best k elements seen so far, each tagged with its input position.
+     * The heap's top is the kept element that would come last, so a newcomer only has to beat
+     * that one. Ties go to the earlier position, which makes the result match a stable sort.
+     */
+    template <typename T, typename Comparator>
+    class TopKHeap {
+    public:
+        struct Entry {
+            T value;
+            std::size_t index;
+        };
+
+    private:
+        struct ComesBefore {
+            Comparator cmp;
+            bool operator()(const Entry& a, const Entry& b) const {
+                if (cmp(a.value, b.value)) return true;
+                if (cmp(b.value, a.value)) return false;
+                return a.index < b.index;
+            }
+        };
+
+        VectorHeapStorage<Entry, ComesBefore> heap_;
+        std::size_t k_;
+        Comparator cmp_;
+
+    public:
+        // expected: number of elements that will be offered, when known (0 otherwise).
+        TopKHeap(std::size_t k, Comparator cmp, std::size_t expected = 0)
+            : heap_(ComesBefore{cmp}), k_(k), cmp_(cmp) {
+            heap_.reserve(expected ? std::min(k, expected) : std::min<std::size_t>(k, 1024));
+        }
+
+        // Positions must be offered in increasing order, so a tie never displaces a kept element.
+        void offer(const T& x, std::size_t index) {
+            if (heap_.size() < k_) {
+                heap_.push(Entry{x, index});
+            } else if (k_ > 0 && cmp_(x, heap_.top().value)) {
+                heap_.pop();
+                heap_.push(Entry{x, index});
+            }
+        }
+
+        // Offers an already tagged element from anywhere in the input (e.g. another heap's drain).
+        void offer(Entry&& e) {
+            if (heap_.size() < k_) {
+                heap_.push(std::move(e));
+            } else if (k_ > 0 && ComesBefore{cmp_}(e, heap_.top())) {
+                heap_.pop();
+                heap_.push(std::move(e));
+            }
+        }
+
+        // Empties the heap into a vector in final order.
+        std::vector<Entry> drain() {
+            std::vector<Entry> out;
+            out.reserve(heap_.size());
+            while (!heap_.empty()) {
+                out.push_back(heap_.top());
+                heap_.pop();
+            }
+            std::reverse(out.begin(), out.end());
+            return out;
+        }
+    };
+
+    template <typename Result, typename Heap>
+    Result collectTopK(Heap& heap) {
+        Result result;
+        auto best = heap.drain();
+        if constexpr (Reservable<Result>) result.reserve(best.size());
+        for (auto& entry : best) result.push_back(std::move(entry.value));
+        return result;
+    }
+
+    // Introselect over positions: O(N) to find the boundary, then only the k winners are sorted.
+    template <typename Result, typename Container, typename Comparator>
+    Result topKSelect(const Container& input, std::size_t k, Comparator cmp) {
+        auto first = input.begin();
+        std::vector<std::size_t> order(static_cast<std::size_t>(std::distance(first, input.end())));
+        std::iota(order.begin(), order.end(), std::size_t{0});
+        auto before = [&](std::size_t a, std::size_t b) {
+            if (cmp(first[a], first[b])) return true;
+            if (cmp(first[b], first[a])) return false;
+            return a < b;
+        };
+        k = std::min(k, order.size());
+        std::nth_element(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(k), order.end(), before);
+        std::sort(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(k), before);
+
+        Result result;
+        if constexpr (Reservable<Result>) result.reserve(k);
+        for (std::size_t i = 0; i < k; ++i) result.push_back(first[order[i]]);
+        return result;
+    }
+}
+
+/**
+ * TopK: The first k elements under cmp, in that order; exactly the first k of a stable
+ * sort(input, cmp) without sorting the rest. With std::greater it yields the k largest.
+ *   auto best = ds::topK(freqs, 20, [](auto& a, auto& b) { return a.count > b.count; });
+ * Any iterable input goes through a bounded heap of k elements: O(N log k) time, O(k) memory,
+ * and most elements cost one comparison once the heap is full. Random-access inputs with a
+ * large k (more than 1/16 of N) use introselect over positions instead: O(N + k log k).
+ */
+template <typename Out = void, typename Container, typename Comparator = std::less<typename Container::value_type>>
+requires Iterable<Container>
+auto topK(const Container& input, std::size_t k, Comparator cmp = Comparator{})
+    -> internal::ResultStorage<Out, LinkedListStorage<typename Container::value_type>> {
+    using T = typename Container::value_type;
+    using Result = internal::ResultStorage<Out, LinkedListStorage<T>>;
+
+    if constexpr (std::random_access_iterator<decltype(input.begin())>) {
+        std::size_t n = static_cast<std::size_t>(std::distance(input.begin(), input.end()));
+        if (k > n / 16) return internal::topKSelect<Result>(input, k, cmp);
+    }
+
+    std::size_t expected = 0;
+    if constexpr (Sized<Container>) expected = input.size();
+    internal::TopKHeap<T, Comparator> heap(k, cmp, expected);
+    std::size_t index = 0;
+    for (const auto& item : input) heap.offer(item, index++);
+    return internal::collectTopK<Result>(heap);
+}
+
+} // namespace ds
@@ -0,0 +1,69 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ds::columnar {
+
+template <typename T>
+concept ColumnValue = std::is_same_v<T, std::int32_t> || std::is_same_v<T, std::int64_t>;
+
+/**
+ * Column: One contiguous, 64-byte aligned buffer of int32 or int64 values.
+ * The layout SIMD kernels want: no per-element nodes, no padding, cache-line aligned.
+ * Also an ordinary back-pushable, random-access container, so the generic ds:: algorithms
+ * (reduce, sort_inplace, countInversions, ...) accept it unchanged.
+ */
+template <ColumnValue T>
+class Column {
+  T* data_{nullptr};
+  std::size_t n_{0};
+  std::size_t cap_{0};
+
+  void regrow(std::size_t newCap);
+
+public:
+  using value_type = T;
+  static constexpr std::size_t alignment = 64;
+
+  Column() = default;
+  Column(std::initializer_list<T> init);
+  ~Column();
+
+  // Rule of 5: Enable Copy and Move
+  Column(const Column& other);
+  Column(Column&& other) noexcept;
+  Column& operator=(const Column& other);
+  Column& operator=(Column&& other) noexcept;
+
+  // Replaces the contents with any range of values convertible to T.
+  template <typename It> void assign(It first, It last);
+
+  T* data() { return data_; }
+  const T* data() const { return data_; }
+  T* begin() { return data_; }
+  T* end() { return data_ + n_; }
+  const T* begin() const { return data_; }
+  const T* end() const { return data_ + n_; }
+  T& operator[](std::size_t i) { return data_[i]; }
+  const T& operator[](std::size_t i) const { return data_[i]; }
+
+  void push_back(T x);
+  void reserve(std::size_t n);
+  // Shrinking keeps the first n values; growing zero-fills.
+  void resize(std::size_t n);
+  void clear() { n_ = 0; }
+  std::size_t capacity() const { return cap_; }
+  std::size_t size() const { return n_; }
+  bool empty() const { return n_ == 0; }
+};
+
+} // namespace ds::columnar
+
+#include "Column.tpp"
@@ -0,0 +1,89 @@
+namespace ds::columnar {
+
+template <ColumnValue T>
+Column<T>::Column(std::initializer_list<T> init) {
+  assign(init.begin(), init.end());
+}
+
+template <ColumnValue T>
+Column<T>::~Column() {
+  if (data_) ::operator delete(data_, std::align_val_t{alignment});
+}
+
+// Copy Constructor
+template <ColumnValue T>
+Column<T>::Column(const Column& other) {
+  reserve(other.n_);
+  if (other.n_) std::memcpy(data_, other.data_, other.n_ * sizeof(T));
+  n_ = other.n_;
+}
+
+// Move Constructor
+template <ColumnValue T>
+Column<T>::Column(Column&& other) noexcept : data_(other.data_), n_(other.n_), cap_(other.cap_) {
+  other.data_ = nullptr;
+  other.n_ = other.cap_ = 0;
+}
+
+// Copy Assignment
+template <ColumnValue T>
+Column<T>& Column<T>::operator=(const Column& other) {
+  if (this != &other) {
+    n_ = 0;
+    reserve(other.n_);
+    if (other.n_) std::memcpy(data_, other.data_, other.n_ * sizeof(T));
+    n_ = other.n_;
+  }
+  return *this;
+}
+
+// Move Assignment
+template <ColumnValue T>
+Column<T>& Column<T>::operator=(Column&& other) noexcept {
+  if (this != &other) {
+    if (data_) ::operator delete(data_, std::align_val_t{alignment});
+    data_ = other.data_; n_ = other.n_; cap_ = other.cap_;
+    other.data_ = nullptr;
+    other.n_ = other.cap_ = 0;
+  }
+  return *this;
+}
+
+template <ColumnValue T>
+void Column<T>::regrow(std::size_t newCap) {
+  T* nd = static_cast<T*>(::operator new(newCap * sizeof(T), std::align_val_t{alignment}));
+  if (n_) std::memcpy(nd, data_, n_ * sizeof(T));
+  if (data_) ::operator delete(data_, std::align_val_t{alignment});
+  data_ = nd;
+  cap_ = newCap;
+}
+
+template <ColumnValue T>
+void Column<T>::reserve(std::size_t n) {
+  if (n > cap_) regrow(std::max<std::size_t>(n, 16));
+}
+
+template <ColumnValue T>
+void Column<T>::resize(std::size_t n) {
+  reserve(n);
+  if (n > n_) std::fill(data_ + n_, data_ + n, T{0});
+  n_ = n;
+}
+
+template <ColumnValue T>
+void Column<T>::push_back(T x) {
+  if (n_ == cap_) regrow(cap_ ? cap_ * 2 : 16);
+  data_[n_++] = x;
+}
+
+template <ColumnValue T>
+template <typename It>
+void Column<T>::assign(It first, It last) {
+  n_ = 0;
+  if constexpr (std::forward_iterator<It>) {
+    reserve(static_cast<std::size_t>(std::distance(first, last)));
+  }
+  for (; first != last; ++first) push_back(static_cast<T>(*first));
+}
+
+} // namespace ds::columnar
@@ -0,0 +1,339 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include "Column.hpp"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define DS_COLUMNAR_X86 1
+#else
+#define DS_COLUMNAR_X86 0
+#endif
+
+namespace ds::columnar {
+
+enum class Compare { Greater, Less, Equal };
+
+// Instruction set a kernel runs with; defaults to the best the CPU supports.
+enum class Isa { Scalar, AVX2 };
+
+inline Isa bestIsa() {
+#if DS_COLUMNAR_X86
+    static const Isa isa = __builtin_cpu_supports("avx2") ? Isa::AVX2 : Isa::Scalar;
+    return isa;
+#else
+    return Isa::Scalar;
+#endif
+}
+
+namespace internal {
+    template <Compare C, typename T>
+    bool matches(T x, T v) {
+        if constexpr (C == Compare::Greater) return x > v;
+        else if constexpr (C == Compare::Less) return x < v;
+        else return x == v;
+    }
+
+    // Calls f with the comparison as a template argument, so kernels branch once, not per element.
+    template <typename F>
+    decltype(auto) withCompare(Compare c, F&& f) {
+        switch (c) {
+            case Compare::Greater: return f(std::integral_constant<Compare, Compare::Greater>{});
+            case Compare::Less:    return f(std::integral_constant<Compare, Compare::Less>{});
+            default:               return f(std::integral_constant<Compare, Compare::Equal>{});
+        }
+    }
+
+    // --- Scalar kernels (also handle the tails of the SIMD ones) ---
+
+    // Branch-free compaction: every value is written, the output cursor only advances on a match.
+    template <Compare C, typename T>
+    std::size_t filterScalar(T* p, std::size_t i, std::size_t out, std::size_t n, T v) {
+        for (; i < n; ++i) {
+            T x = p[i];
+            p[out] = x;
+            out += matches<C>(x, v);
+        }
+        return out;
+    }
+
+    // Wrapping arithmetic: x * mul + add modulo 2^bits, like the SIMD lanes.
+    template <typename T>
+    void affineScalar(T* p, std::size_t i, std::size_t n, T mul, T add) {
+        using U = std::make_unsigned_t<T>;
+        for (; i < n; ++i) p[i] = static_cast<T>(static_cast<U>(p[i]) * static_cast<U>(mul) + static_cast<U>(add));
+    }
+
+    template <typename T>
+    std::uint64_t sumScalar(const T* p, std::size_t i, std::size_t n) {
+        std::uint64_t acc = 0;
+        for (; i < n; ++i) acc += static_cast<std::uint64_t>(static_cast<std::int64_t>(p[i]));
+        return acc;
+    }
+
+    template <Compare C, typename T>
+    std::size_t countScalar(const T* p, std::size_t i, std::size_t n, T v) {
+        std::size_t c = 0;
+        for (; i < n; ++i) c += matches<C>(p[i], v);
+        return c;
+    }
+
+#if DS_COLUMNAR_X86
+    // Compaction shuffles: row m lists the 32-bit lanes to keep for match mask m, kept lanes first.
+    constexpr std::array<std::array<std::int32_t, 8>, 256> makeCompress32() {
+        std::array<std::array<std::int32_t, 8>, 256> t{};
+        for (unsigned m = 0; m < 256; ++m) {
+            unsigned k = 0;
+            for (unsigned lane = 0; lane < 8; ++lane) {
+                if (m >> lane & 1) t[m][k++] = static_cast<std::int32_t>(lane);
+            }
+        }
+        return t;
+    }
+    // Same for 64-bit lanes, expressed as pairs of 32-bit lanes for vpermd.
+    constexpr std::array<std::array<std::int32_t, 8>, 16> makeCompress64() {
+        std::array<std::array<std::int32_t, 8>, 16> t{};
+        for (unsigned m = 0; m < 16; ++m) {
+            unsigned k = 0;
+            for (unsigned lane = 0; lane < 4; ++lane) {
+                if (m >> lane & 1) {
+                    t[m][k++] = static_cast<std::int32_t>(2 * lane);
+                    t[m][k++] = static_cast<std::int32_t>(2 * lane + 1);
+                }
+            }
+        }
+        return t;
+    }
+    alignas(32) inline constexpr auto kCompress32 = makeCompress32();
+    alignas(32) inline constexpr auto kCompress64 = makeCompress64();
+
+    template <Compare C>
+    __attribute__((target("avx2"))) inline __m256i compare32(__m256i x, __m256i v) {
+        if constexpr (C == Compare::Greater) return _mm256_cmpgt_epi32(x, v);
+        else if constexpr (C == Compare::Less) return _mm256_cmpgt_epi32(v, x);
+        else return _mm256_cmpeq_epi32(x, v);
+    }
+
+    template <Compare C>
+    __attribute__((target("avx2"))) inline __m256i compare64(__m256i x, __m256i v) {
+        if constexpr (C == Compare::Greater) return _mm256_cmpgt_epi64(x, v);
+        else if constexpr (C == Compare::Less) return _mm256_cmpgt_epi64(v, x);
+        else return _mm256_cmpeq_epi64(x, v);
+    }
+
+    // Low 64 bits of a * b per lane (AVX2 has no 64-bit multiply): lo*lo + (hi*lo + lo*hi) << 32.
+    __attribute__((target("avx2"))) inline __m256i mul64(__m256i a, __m256i b) {
+        __m256i lo = _mm256_mul_epu32(a, b);
+        __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b),
+                                         _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+        return _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+    }
+
+    __attribute__((target("avx2"))) inline std::uint64_t horizontalSum64(__m256i acc) {
+        alignas(32) std::uint64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+
+    /**
+     * Stream compaction, 8 (int32) or 4 (int64) values per step: compare, turn the lane mask
+     * into a shuffle from the table, and store the kept lanes contiguously at the output
+     * cursor. The store may write junk past the kept lanes, but never past the block just read.
+     */
+    template <Compare C, typename T>
+    __attribute__((target("avx2"))) std::size_t filterAvx2(T* p, std::size_t n, T v) {
+        std::size_t out = 0;
+        std::size_t i = 0;
+        if constexpr (sizeof(T) == 4) {
+            const __m256i vv = _mm256_set1_epi32(v);
+            for (; i + 8 <= n; i += 8) {
+                __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+                unsigned m = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(compare32<C>(x, vv))));
+                __m256i idx = _mm256_load_si256(reinterpret_cast<const __m256i*>(kCompress32[m].data()));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(p + out), _mm256_permutevar8x32_epi32(x, idx));
+                out += static_cast<std::size_t>(std::popcount(m));
+            }
+        } else {
+            const __m256i vv = _mm256_set1_epi64x(v);
+            for (; i + 4 <= n; i += 4) {
+                __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+                unsigned m = static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(compare64<C>(x, vv))));
+                __m256i idx = _mm256_load_si256(reinterpret_cast<const __m256i*>(kCompress64[m].data()));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(p + out), _mm256_permutevar8x32_epi32(x, idx));
+                out += static_cast<std::size_t>(std::popcount(m));
+            }
+        }
+        return filterScalar<C>(p, i, out, n, v);
+    }
+
+    template <typename T>
+    __attribute__((target("avx2"))) void affineAvx2(T* p, std::size_t n, T mul, T add) {
+        std::size_t i = 0;
+        constexpr std::size_t lanes = 32 / sizeof(T);
+        if constexpr (sizeof(T) == 4) {
+            const __m256i vm = _mm256_set1_epi32(mul);
+            const __m256i va = _mm256_set1_epi32(add);
+            for (; i + lanes <= n; i += lanes) {
+                __m256i* q = reinterpret_cast<__m256i*>(p + i);
+                _mm256_storeu_si256(q, _mm256_add_epi32(_mm256_mullo_epi32(_mm256_loadu_si256(q), vm), va));
+            }
+        } else {
+            const __m256i vm = _mm256_set1_epi64x(mul);
+            const __m256i va = _mm256_set1_epi64x(add);
+            for (; i + lanes <= n; i += lanes) {
+                __m256i* q = reinterpret_cast<__m256i*>(p + i);
+                _mm256_storeu_si256(q, _mm256_add_epi64(mul64(_mm256_loadu_si256(q), vm), va));
+            }
+        }
+        affineScalar(p, i, n, mul, add);
+    }
+
+    template <typename T>
+    __attribute__((target("avx2"))) std::uint64_t sumAvx2(const T* p, std::size_t n) {
+        __m256i acc = _mm256_setzero_si256();
+        std::size_t i = 0;
+        if constexpr (sizeof(T) == 4) {
+            // Widen to 64-bit lanes so the sum cannot overflow 32 bits.
+            for (; i + 8 <= n; i += 8) {
+                __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+                acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(x)));
+                acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(x, 1)));
+            }
+        } else {
+            for (; i + 4 <= n; i += 4) {
+                acc = _mm256_add_epi64(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)));
+            }
+        }
+        return horizontalSum64(acc) + sumScalar(p, i, n);
+    }
+
+    // Smallest (Max = false) or largest value of a non-empty range.
+    template <bool Max, typename T>
+    __attribute__((target("avx2"))) T extremeAvx2(const T* p, std::size_t n) {
+        constexpr std::size_t lanes = 32 / sizeof(T);
+        T best = p[0];
+        std::size_t i = 0;
+        if (n >= lanes) {
+            __m256i acc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+            for (i = lanes; i + lanes <= n; i += lanes) {
+                __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+                if constexpr (sizeof(T) == 4) {
+                    acc = Max ? _mm256_max_epi32(acc, x) : _mm256_min_epi32(acc, x);
+                } else {
+                    __m256i takeX = Max ? _mm256_cmpgt_epi64(x, acc) : _mm256_cmpgt_epi64(acc, x);
+                    acc = _mm256_blendv_epi8(acc, x, takeX);
+                }
+            }
+            alignas(32) T out[lanes];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(out), acc);
+            for (T x : out) best = Max ? (x > best ? x : best) : (x < best ? x : best);
+        }
+        for (; i < n; ++i) best = Max ? (p[i] > best ? p[i] : best) : (p[i] < best ? p[i] : best);
+        return best;
+    }
+
+    template <Compare C, typename T>
+    __attribute__((target("avx2"))) std::size_t countAvx2(const T* p, std::size_t n, T v) {
+        std::size_t c = 0;
+        std::size_t i = 0;
+        if constexpr (sizeof(T) == 4) {
+            const __m256i vv = _mm256_set1_epi32(v);
+            for (; i + 8 <= n; i += 8) {
+                __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+                c += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(
+                    _mm256_movemask_ps(_mm256_castsi256_ps(compare32<C>(x, vv))))));
+            }
+        } else {
+            const __m256i vv = _mm256_set1_epi64x(v);
+            for (; i + 4 <= n; i += 4) {
+                __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+                c += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(
+                    _mm256_movemask_pd(_mm256_castsi256_pd(compare64<C>(x, vv))))));
+            }
+        }
+        return c + countScalar<C>(p, i, n, v);
+    }
+#endif
+}
+
+/**
+ * Filter: Keeps the values for which (x cmp value) holds, compacting the column in place
+ * (stable, no allocation).
+ */
+template <ColumnValue T>
+void filter(Column<T>& col, Compare cmp, T value, Isa isa = bestIsa()) {
+    std::size_t kept = internal::withCompare(cmp, [&](auto c) -> std::size_t {
+#if DS_COLUMNAR_X86
+        if (isa == Isa::AVX2) return internal::filterAvx2<decltype(c)::value>(col.data(), col.size(), value);
+#endif
+        (void)isa;
+        return internal::filterScalar<decltype(c)::value>(col.data(), 0, 0, col.size(), value);
+    });
+    col.resize(kept);
+}
+
+/**
+ * Affine Map: x = x * mul + add for every value, in place. Arithmetic wraps modulo 2^32 / 2^64.
+ */
+template <ColumnValue T>
+void affine(Column<T>& col, T mul, T add, Isa isa = bestIsa()) {
+#if DS_COLUMNAR_X86
+    if (isa == Isa::AVX2) { internal::affineAvx2(col.data(), col.size(), mul, add); return; }
+#endif
+    (void)isa;
+    internal::affineScalar(col.data(), 0, col.size(), mul, add);
+}
+
+/**
+ * Sum: Total of all values as a 64-bit integer (int32 columns never overflow it).
+ */
+template <ColumnValue T>
+std::int64_t sum(const Column<T>& col, Isa isa = bestIsa()) {
+#if DS_COLUMNAR_X86
+    if (isa == Isa::AVX2) return static_cast<std::int64_t>(internal::sumAvx2(col.data(), col.size()));
+#endif
+    (void)isa;
+    return static_cast<std::int64_t>(internal::sumScalar(col.data(), 0, col.size()));
+}
+
+// Min / Max: empty for an empty column.
+template <ColumnValue T>
+std::optional<T> min(const Column<T>& col, Isa isa = bestIsa()) {
+    if (col.empty()) return std::nullopt;
+#if DS_COLUMNAR_X86
+    if (isa == Isa::AVX2) return internal::extremeAvx2<false>(col.data(), col.size());
+#endif
+    (void)isa;
+    return *std::min_element(col.begin(), col.end());
+}
+
+template <ColumnValue T>
+std::optional<T> max(const Column<T>& col, Isa isa = bestIsa()) {
+    if (col.empty()) return std::nullopt;
+#if DS_COLUMNAR_X86
+    if (isa == Isa::AVX2) return internal::extremeAvx2<true>(col.data(), col.size());
+#endif
+    (void)isa;
+    return *std::max_element(col.begin(), col.end());
+}
+
+/**
+ * Count: Number of values with (x cmp value).
+ */
+template <ColumnValue T>
+std::size_t count(const Column<T>& col, Compare cmp, T value, Isa isa = bestIsa()) {
+    return internal::withCompare(cmp, [&](auto c) -> std::size_t {
+#if DS_COLUMNAR_X86
+        if (isa == Isa::AVX2) return internal::countAvx2<decltype(c)::value>(col.data(), col.size(), value);
+#endif
+        (void)isa;
+        return internal::countScalar<decltype(c)::value>(col.data(), 0, col.size(), value);
+    });
+}
+
+} // namespace ds::columnar
@@ -10,6 +10,20 @@ concept Container = requires(const T& c) {
     { c.empty() } -> std::convertible_to<bool>;
 };
 
+template<typename T>
+concept Sized = requires(const T& c) {
+    { c.size() } -> std::convertible_to<std::size_t>;
+};
+
+template<typename S>
+concept Reservable = requires(S& s, std::size_t n) { s.reserve(n); };
+
+template<typename R>
+concept Iterable = requires(const R& r) {
+    r.begin();
+    r.end();
+};
+
 template<typename S, typename T>
 concept BackPushable = requires(S& s, const T& val) { s.push_back(val); };
 
@@ -55,5 +69,15 @@ template<typename S, typename T>
 concept PriorityQueueStorage = Container<S> && 
                                HeapPushable<S, T> && HeapPoppable<S> && HeapAccessible<S, T>;
 
+// A priority queue storage whose push returns a handle for later update / erase / contains.
+template<typename S, typename T>
+concept AddressableHeapStorage = PriorityQueueStorage<S, T> &&
+                                 requires(S& s, const S& cs, typename S::handle_type h, const T& val) {
+    { s.push(val) } -> std::convertible_to<typename S::handle_type>;
+    s.update(h, val);
+    s.erase(h);
+    { cs.contains(h) } -> std::convertible_to<bool>;
+};
+
 } // namespace ds
 
@@ -0,0 +1,77 @@
+#pragma once
+#include "../interfaces/IPriorityQueue.hpp"
+#include "../storage/IndexedHeapStorage.hpp"
+#include "../concepts.hpp"
+#include <concepts>
+#include <functional>
+#include <utility>
+
+namespace ds {
+
+/**
+ * AddressablePriorityQueue: A PriorityQueue whose elements can be reprioritised or removed
+ * in place instead of pushing duplicates and skipping stale entries on pop:
+ *   auto h = pq.insert({dist, v});  ...  pq.update(h, {shorter, v});
+ * insert returns the handle; the IPriorityQueue push overloads drop it.
+ */
+template <typename T, typename Compare = std::less<T>, typename Storage = IndexedHeapStorage<T, Compare>>
+requires AddressableHeapStorage<Storage, T>
+class AddressablePriorityQueue final : public IPriorityQueue<T, Compare> {
+  Storage s_;
+
+  T takeTop() {
+    if constexpr (requires(Storage& s) { s.take_top(); }) return s_.take_top();
+    else { T x = s_.top(); s_.pop(); return x; }
+  }
+public:
+  using value_type = T;
+  using handle_type = typename Storage::handle_type;
+
+  AddressablePriorityQueue() = default;
+  explicit AddressablePriorityQueue(Compare c) : s_(c) {}
+  template <typename It>
+  requires std::constructible_from<Storage, It, It, Compare>
+  AddressablePriorityQueue(It first, It last, Compare c = Compare{}) : s_(first, last, c) {}
+  std::size_t size() const override { return s_.size(); }
+  bool empty() const override { return s_.empty(); }
+  void push(const T& x) override { s_.push(x); }
+  void push(T&& x) override { s_.push(std::move(x)); }
+  handle_type insert(const T& x) { return s_.push(x); }
+  handle_type insert(T&& x) { return s_.push(std::move(x)); }
+  template <typename... Args>
+  requires requires(Storage& s, Args&&... args) { s.emplace(std::forward<Args>(args)...); }
+  handle_type emplace(Args&&... args) { return s_.emplace(std::forward<Args>(args)...); }
+  void pop() override { s_.pop(); }
+  const T& top() const override { return s_.top(); }
+  handle_type top_handle() const { return s_.top_handle(); }
+
+  // push_range reserves once for the whole span.
+  void push_range(std::span<const T> xs) override {
+    s_.reserve(s_.size() + xs.size());
+    for (const T& x : xs) s_.push(x);
+  }
+  std::size_t pop_n(T* out, std::size_t n) override {
+    std::size_t k = 0;
+    for (; k < n && !s_.empty(); ++k) out[k] = takeTop();
+    return k;
+  }
+  std::size_t drain_into(IPriorityQueue<T, Compare>& sink) override {
+    if (&sink == this) return 0;
+    return internal::drainBatched<T>(s_.size(), [this] { return takeTop(); },
+                                     [&sink](std::span<const T> xs) { sink.push_range(xs); });
+  }
+
+  void update(handle_type h, const T& x) { s_.update(h, x); }
+  void update(handle_type h, T&& x) { s_.update(h, std::move(x)); }
+  void erase(handle_type h) { s_.erase(h); }
+  bool contains(handle_type h) const { return s_.contains(h); }
+  const T& value(handle_type h) const { return s_.value(h); }
+  void reserve(std::size_t n) { s_.reserve(n); }
+
+  // Functional support: expose read-only iterators
+  // Note: Order is implementation-dependent (heap layout), not necessarily sorted
+  auto begin() const { return s_.begin(); }
+  auto end() const { return s_.end(); }
+};
+
+} // namespace ds
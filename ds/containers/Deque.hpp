@@ -2,6 +2,7 @@
 #include "../interfaces/IDeque.hpp"
 #include "../storage/LinkedListStorage.hpp"
 #include "../concepts.hpp"
+#include <utility>
 
 namespace ds {
 
@@ -9,6 +10,11 @@ template <typename T, typename Storage = LinkedListStorage<T>>
 requires SequenceStorage<Storage, T>
 class Deque final : public IDeque<T> {
   Storage s_;
+
+  T takeFront() {
+    if constexpr (requires(Storage& s) { s.take_front(); }) return s_.take_front();
+    else { T x = s_.front(); s_.pop_front(); return x; }
+  }
 public:
   using value_type = T;
 
@@ -16,11 +22,43 @@ public:
   bool empty() const override { return s_.empty(); }
   void push_front(const T& x) override { s_.push_front(x); }
   void push_back (const T& x) override { s_.push_back(x); }
+  void push_front(T&& x) override { s_.push_front(std::move(x)); }
+  void push_back (T&& x) override { s_.push_back(std::move(x)); }
+  template <typename... Args>
+  requires requires(Storage& s, Args&&... args) { s.emplace_front(std::forward<Args>(args)...); }
+  void emplace_front(Args&&... args) { s_.emplace_front(std::forward<Args>(args)...); }
+  template <typename... Args>
+  requires requires(Storage& s, Args&&... args) { s.emplace_back(std::forward<Args>(args)...); }
+  void emplace_back(Args&&... args) { s_.emplace_back(std::forward<Args>(args)...); }
   void pop_front() override { s_.pop_front(); }
   void pop_back () override { s_.pop_back(); }
   const T& front() const override { return s_.front(); }
   const T& back () const override { return s_.back(); }
 
+  void push_range(std::span<const T> xs) override {
+    if constexpr (Reservable<Storage>) s_.reserve(s_.size() + xs.size());
+    for (const T& x : xs) s_.push_back(x);
+  }
+  std::size_t pop_n(T* out, std::size_t n) override {
+    std::size_t k = 0;
+    for (; k < n && !s_.empty(); ++k) out[k] = takeFront();
+    return k;
+  }
+  // Into a Deque of the same type over a list storage: one O(1) splice of the whole chain.
+  // Other sinks get batches.
+  std::size_t drain_into(IDeque<T>& sink) override {
+    if (&sink == this) return 0;
+    std::size_t n = s_.size();
+    if constexpr (requires(Storage& s) { s.splice_back(std::move(s)); }) {
+      if (auto* same = dynamic_cast<Deque*>(&sink)) {
+        same->s_.splice_back(std::move(s_));
+        return n;
+      }
+    }
+    return internal::drainBatched<T>(n, [this] { return takeFront(); },
+                                     [&sink](std::span<const T> xs) { sink.push_range(xs); });
+  }
+
   // Functional support: expose read-only iterators
   auto begin() const { return s_.begin(); }
   auto end() const { return s_.end(); }
@@ -0,0 +1,141 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace ds {
+
+/**
+ * MpmcQueue: Bounded lock-free queue for any number of producer and consumer threads
+ * (Vyukov's array queue). Every cell carries a sequence number telling which lap of which side
+ * may use it next, so a producer or consumer claims a cell with one CAS on the tail / head
+ * (each on its own cache line) and hands it over with one release store on the cell.
+ *
+ * Not an IQueue: front() cannot be made safe while other consumers pop, so elements leave only
+ * through try_dequeue, which moves them out. enqueue waits (yielding) while the queue is full;
+ * size() is a snapshot. The bulk variants claim a run of consecutive cells with a single CAS.
+ */
+template <typename T>
+class MpmcQueue {
+  static_assert(std::is_nothrow_move_constructible_v<T>, "queue elements must be nothrow movable");
+  static constexpr std::size_t kCacheLine = 64;
+
+  struct Cell {
+    std::atomic<std::size_t> seq;
+    alignas(T) unsigned char bytes[sizeof(T)];
+    T* value() { return std::launder(reinterpret_cast<T*>(bytes)); }
+  };
+
+  std::unique_ptr<Cell[]> buf_;
+  std::size_t mask_;
+
+  alignas(kCacheLine) std::atomic<std::size_t> tail_{0};   // next position to write
+  alignas(kCacheLine) std::atomic<std::size_t> head_{0};   // next position to read
+
+  static std::intptr_t diff(std::size_t a, std::size_t b) {
+    return static_cast<std::intptr_t>(a - b);
+  }
+
+  // Claims up to want consecutive cells on one side. Cell pos + i is ready for that side when
+  // its sequence is pos + i + lag (lag 0 for producers, 1 for consumers). Only a thread that has
+  // moved `end` past a ready cell can change it, so if the CAS succeeds every counted cell is ours.
+  std::size_t claim(std::atomic<std::size_t>& end, std::size_t lag, std::size_t want, std::size_t& pos) {
+    pos = end.load(std::memory_order_relaxed);
+    for (;;) {
+      std::size_t ready = 0;
+      while (ready < want && buf_[(pos + ready) & mask_].seq.load(std::memory_order_acquire) == pos + ready + lag) ++ready;
+      if (ready == 0) {
+        // Behind: the cell still holds the previous lap (full / empty). Ahead: another thread won.
+        if (diff(buf_[pos & mask_].seq.load(std::memory_order_acquire), pos + lag) < 0) return 0;
+        pos = end.load(std::memory_order_relaxed);
+        continue;
+      }
+      if (end.compare_exchange_weak(pos, pos + ready, std::memory_order_relaxed)) return ready;
+    }
+  }
+
+  bool put(T&& x) {
+    std::size_t pos;
+    if (!claim(tail_, 0, 1, pos)) return false;
+    Cell& c = buf_[pos & mask_];
+    ::new (static_cast<void*>(c.bytes)) T(std::move(x));
+    c.seq.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+public:
+  using value_type = T;
+
+  explicit MpmcQueue(std::size_t capacity = 1024) {
+    std::size_t cap = 2;
+    while (cap < capacity) cap <<= 1;
+    buf_ = std::make_unique<Cell[]>(cap);
+    for (std::size_t i = 0; i < cap; ++i) buf_[i].seq.store(i, std::memory_order_relaxed);
+    mask_ = cap - 1;
+  }
+  ~MpmcQueue() {
+    std::size_t tail = tail_.load(std::memory_order_relaxed);
+    for (std::size_t i = head_.load(std::memory_order_relaxed); i != tail; ++i) buf_[i & mask_].value()->~T();
+  }
+  MpmcQueue(const MpmcQueue&) = delete;
+  MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+  std::size_t capacity() const { return mask_ + 1; }
+  std::size_t size() const {
+    std::size_t head = head_.load(std::memory_order_acquire);
+    std::size_t tail = tail_.load(std::memory_order_acquire);
+    return diff(tail, head) > 0 ? std::min(tail - head, capacity()) : 0;
+  }
+  bool empty() const { return size() == 0; }
+
+  // A copy is made before a cell is claimed, so a throwing copy leaves the queue untouched.
+  bool try_enqueue(const T& x) { return put(T(x)); }
+  bool try_enqueue(T&& x) { return put(std::move(x)); }
+  template <typename... Args>
+  bool try_emplace(Args&&... args) { return put(T(std::forward<Args>(args)...)); }
+  // Moves up to n elements out of [first, first + n); returns how many were enqueued.
+  template <typename It>
+  std::size_t try_enqueue_bulk(It first, std::size_t n) {
+    std::size_t pos;
+    std::size_t count = n ? claim(tail_, 0, std::min(n, capacity()), pos) : 0;
+    for (std::size_t i = 0; i < count; ++i, ++first) {
+      Cell& c = buf_[(pos + i) & mask_];
+      ::new (static_cast<void*>(c.bytes)) T(std::move(*first));
+      c.seq.store(pos + i + 1, std::memory_order_release);
+    }
+    return count;
+  }
+  void enqueue(const T& x) {
+    T copy(x);
+    while (!put(std::move(copy))) std::this_thread::yield();
+  }
+  void enqueue(T&& x) {
+    while (!put(std::move(x))) std::this_thread::yield();
+  }
+
+  bool try_dequeue(T& out) {
+    return try_dequeue_bulk(&out, 1) == 1;
+  }
+  // Moves up to max elements to out; returns how many were dequeued.
+  template <typename OutIt>
+  std::size_t try_dequeue_bulk(OutIt out, std::size_t max) {
+    std::size_t pos;
+    std::size_t count = max ? claim(head_, 1, std::min(max, capacity()), pos) : 0;
+    for (std::size_t i = 0; i < count; ++i) {
+      Cell& c = buf_[(pos + i) & mask_];
+      *out = std::move(*c.value());
+      ++out;
+      c.value()->~T();
+      c.seq.store(pos + i + mask_ + 1, std::memory_order_release);
+    }
+    return count;
+  }
+};
+
+} // namespace ds
@@ -0,0 +1,180 @@
+#pragma once
+#include "../storage/VectorHeapStorage.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace ds {
+
+/**
+ * MultiQueue: Relaxed concurrent priority queue (Rihani, Sanders, Dementiev, SPAA 2015).
+ * The elements are spread over threads * factor VectorHeapStorage shards, each behind its own
+ * mutex that is only ever try-locked on the fast path. push goes to a random free shard; try_pop
+ * compares the tops of two random shards and takes the better one. Threads rarely meet on a
+ * shard, so nobody waits on one global lock. When T fits a lock-free atomic every shard
+ * publishes a copy of its top, so the two candidates are compared without locking either and
+ * only the chosen one is locked; other types try-lock both shards to look.
+ *
+ * Relaxed: try_pop returns an element close to the top, not necessarily the top itself. The
+ * expected rank error grows with the shard count (bench/bench_multiqueue.cpp measures it), so
+ * the factor trades ordering quality for less contention. Not an IPriorityQueue: there is no
+ * stable top() to return while other threads pop.
+ */
+template <typename T, typename Compare = std::less<T>>
+class MultiQueue {
+  static constexpr std::size_t kCacheLine = 64;
+
+  static constexpr bool kPeek = [] {
+    if constexpr (std::is_trivially_copyable_v<T>) return std::atomic<T>::is_always_lock_free;
+    else return false;
+  }();
+  struct NoPeek {};
+
+  struct alignas(kCacheLine) Shard {
+    std::mutex m;
+    VectorHeapStorage<T, Compare> heap;
+    // kPeek only: the heap's top as of the last unlock, readable without the lock.
+    std::atomic<bool> hasTop{false};
+    [[no_unique_address]] std::conditional_t<kPeek, std::atomic<T>, NoPeek> top;
+  };
+
+  std::unique_ptr<Shard[]> shards_;
+  std::size_t count_;
+  Compare cmp_;
+  alignas(kCacheLine) std::atomic<std::size_t> size_{0};
+
+  // Per-thread xorshift: cheap, and threads never share random state.
+  static std::uint64_t nextRandom() {
+    thread_local std::uint64_t state = 0x9E3779B97F4A7C15ull ^ std::hash<std::thread::id>{}(std::this_thread::get_id());
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+  }
+  std::size_t randomShard() const { return static_cast<std::size_t>(nextRandom() % count_); }
+
+  // Locks some shard: random try-locks first, one blocking lock after a round of failures.
+  Shard& lockAny() {
+    for (std::size_t attempt = 0; attempt < count_; ++attempt) {
+      Shard& s = shards_[randomShard()];
+      if (s.m.try_lock()) return s;
+    }
+    Shard& s = shards_[randomShard()];
+    s.m.lock();
+    return s;
+  }
+
+  // Called with s locked, after every change to its heap.
+  void publish(Shard& s) {
+    if constexpr (kPeek) {
+      if (!s.heap.empty()) s.top.store(s.heap.top(), std::memory_order_relaxed);
+      s.hasTop.store(!s.heap.empty(), std::memory_order_release);
+    }
+  }
+
+  template <typename U>
+  void put(U&& x) {
+    Shard& s = lockAny();
+    s.heap.push(std::forward<U>(x));
+    publish(s);
+    s.m.unlock();
+    size_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  template <typename OnPop>
+  void take(Shard& s, T& out, OnPop& onPop) {
+    out = s.heap.top();
+    s.heap.pop();
+    publish(s);
+    onPop(static_cast<const T&>(out));
+    size_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  // Two-choice pop on one pair of shards; false when the pair was busy or empty.
+  template <typename OnPop>
+  bool popFromPair(Shard& a, Shard& b, T& out, OnPop& onPop) {
+    if constexpr (kPeek) {
+      bool hasA = a.hasTop.load(std::memory_order_acquire);
+      bool hasB = b.hasTop.load(std::memory_order_acquire);
+      if (!hasA && !hasB) return false;
+      Shard* best = hasA ? &a : &b;
+      if (hasA && hasB && cmp_(a.top.load(std::memory_order_relaxed), b.top.load(std::memory_order_relaxed))) best = &b;
+      if (!best->m.try_lock()) return false;
+      bool took = !best->heap.empty();
+      if (took) take(*best, out, onPop);
+      best->m.unlock();
+      return took;
+    } else {
+      if (!a.m.try_lock()) return false;
+      if (&b != &a && !b.m.try_lock()) {
+        a.m.unlock();
+        return false;
+      }
+      Shard* best = a.heap.empty() ? nullptr : &a;
+      if (!b.heap.empty() && (!best || cmp_(best->heap.top(), b.heap.top()))) best = &b;
+      if (best) take(*best, out, onPop);
+      a.m.unlock();
+      if (&b != &a) b.m.unlock();
+      return best != nullptr;
+    }
+  }
+
+public:
+  using value_type = T;
+
+  // threads: expected number of concurrent users; factor: shards per thread (at least 1).
+  explicit MultiQueue(std::size_t threads = std::thread::hardware_concurrency(), std::size_t factor = 2,
+                      Compare cmp = Compare{})
+      : count_(std::max<std::size_t>(threads, 1) * std::max<std::size_t>(factor, 1)), cmp_(cmp) {
+    shards_ = std::make_unique<Shard[]>(count_);
+    for (std::size_t i = 0; i < count_; ++i) shards_[i].heap = VectorHeapStorage<T, Compare>(cmp);
+  }
+  MultiQueue(const MultiQueue&) = delete;
+  MultiQueue& operator=(const MultiQueue&) = delete;
+
+  std::size_t shards() const { return count_; }
+  // Snapshot; exact only when no other thread is using the queue.
+  std::size_t size() const { return size_.load(std::memory_order_relaxed); }
+  bool empty() const { return size() == 0; }
+
+  void push(const T& x) { put(x); }
+  void push(T&& x) { put(std::move(x)); }
+
+  // Takes the better top of two random shards. Returns false only when a final sweep over
+  // every shard found them all empty.
+  bool try_pop(T& out) {
+    return try_pop(out, [](const T&) {});
+  }
+
+  // onPop(out) runs while the shard is still locked, i.e. at the pop's linearization point
+  // (bench/bench_multiqueue.cpp stamps a global order there to measure rank errors).
+  template <typename OnPop>
+  bool try_pop(T& out, OnPop&& onPop) {
+    for (std::size_t attempt = 0; attempt < count_; ++attempt) {
+      std::size_t i = randomShard();
+      std::size_t j = count_ > 1 ? (i + 1 + randomShard() % (count_ - 1)) % count_ : i;
+      if (popFromPair(shards_[i], shards_[j], out, onPop)) return true;
+      if (empty()) break;
+    }
+    // Nearly empty or heavily contended: visit every shard once.
+    std::size_t start = randomShard();
+    for (std::size_t k = 0; k < count_; ++k) {
+      Shard& s = shards_[(start + k) % count_];
+      std::lock_guard<std::mutex> lk(s.m);
+      if (!s.heap.empty()) {
+        take(s, out, onPop);
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+} // namespace ds
@@ -2,7 +2,10 @@
 #include "../interfaces/IPriorityQueue.hpp"
 #include "../storage/VectorHeapStorage.hpp"
 #include "../concepts.hpp"
+#include <concepts>
 #include <functional>
+#include <type_traits>
+#include <utility>
 
 namespace ds {
 
@@ -10,17 +13,67 @@ template <typename T, typename Compare = std::less<T>, typename Storage = Vector
 requires PriorityQueueStorage<Storage, T>
 class PriorityQueue final : public IPriorityQueue<T, Compare> {
   Storage s_;
+
+  T takeTop() {
+    if constexpr (requires(Storage& s) { s.take_top(); }) return s_.take_top();
+    else { T x = s_.top(); s_.pop(); return x; }
+  }
 public:
   using value_type = T;
 
   PriorityQueue() = default;
   explicit PriorityQueue(Compare c) : s_(c) {}
+  // Bulk load: the storage heapifies the whole range at once instead of N pushes.
+  template <typename It>
+  requires std::constructible_from<Storage, It, It, Compare>
+  PriorityQueue(It first, It last, Compare c = Compare{}) : s_(first, last, c) {}
   std::size_t size() const override { return s_.size(); }
   bool empty() const override { return s_.empty(); }
   void push(const T& x) override { s_.push(x); }
+  void push(T&& x) override { s_.push(std::move(x)); }
+  template <typename... Args>
+  requires requires(Storage& s, Args&&... args) { s.emplace(std::forward<Args>(args)...); }
+  void emplace(Args&&... args) { s_.emplace(std::forward<Args>(args)...); }
+  template <typename It>
+  requires requires(Storage& s, It it) { s.push_range(it, it); }
+  void push_range(It first, It last) { s_.push_range(first, last); }
   void pop() override { s_.pop(); }
   const T& top() const override { return s_.top(); }
 
+  // push_range goes through the storage's, which reserves once and heapifies once when the
+  // batch is large.
+  void push_range(std::span<const T> xs) override {
+    if constexpr (requires(Storage& s) { s.push_range(xs.begin(), xs.end()); }) s_.push_range(xs.begin(), xs.end());
+    else for (const T& x : xs) s_.push(x);
+  }
+  std::size_t pop_n(T* out, std::size_t n) override {
+    if constexpr (requires(Storage& s) { s.pop_n(out, n); }) return s_.pop_n(out, n);
+    else {
+      std::size_t k = 0;
+      for (; k < n && !s_.empty(); ++k) out[k] = takeTop();
+      return k;
+    }
+  }
+  // Into a PriorityQueue of the same type: an empty sink takes the storage by swap (stateless
+  // comparators only), otherwise the storage's merge moves the heap array into the sink's.
+  // Other sinks get batches.
+  std::size_t drain_into(IPriorityQueue<T, Compare>& sink) override {
+    if (&sink == this) return 0;
+    std::size_t n = s_.size();
+    if constexpr (requires(Storage& s) { s.merge(std::move(s)); }) {
+      if (auto* same = dynamic_cast<PriorityQueue*>(&sink)) {
+        if (std::is_empty_v<Compare> && same->s_.empty()) {
+          std::swap(s_, same->s_);
+        } else {
+          same->s_.merge(std::move(s_));
+        }
+        return n;
+      }
+    }
+    return internal::drainBatched<T>(n, [this] { return takeTop(); },
+                                     [&sink](std::span<const T> xs) { sink.push_range(xs); });
+  }
+
   // Functional support: expose read-only iterators
   // Note: Order is implementation-dependent (heap layout), not necessarily sorted
   auto begin() const { return s_.begin(); }
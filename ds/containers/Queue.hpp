@@ -2,6 +2,7 @@
 #include "../interfaces/IQueue.hpp"
 #include "../storage/LinkedListStorage.hpp"
 #include "../concepts.hpp"
+#include <utility>
 
 namespace ds {
 
@@ -9,15 +10,48 @@ template <typename T, typename Storage = LinkedListStorage<T>>
 requires QueueStorage<Storage, T>
 class Queue final : public IQueue<T> {
   Storage s_;
+
+  T takeFront() {
+    if constexpr (requires(Storage& s) { s.take_front(); }) return s_.take_front();
+    else { T x = s_.front(); s_.pop_front(); return x; }
+  }
 public:
   using value_type = T;
   
   std::size_t size() const override { return s_.size(); }
   bool empty() const override { return s_.empty(); }
   void enqueue(const T& x) override { s_.push_back(x); }
+  void enqueue(T&& x) override { s_.push_back(std::move(x)); }
+  template <typename... Args>
+  requires requires(Storage& s, Args&&... args) { s.emplace_back(std::forward<Args>(args)...); }
+  void emplace(Args&&... args) { s_.emplace_back(std::forward<Args>(args)...); }
   void dequeue() override { s_.pop_front(); }
   const T& front() const override { return s_.front(); }
 
+  void push_range(std::span<const T> xs) override {
+    if constexpr (Reservable<Storage>) s_.reserve(s_.size() + xs.size());
+    for (const T& x : xs) s_.push_back(x);
+  }
+  std::size_t pop_n(T* out, std::size_t n) override {
+    std::size_t k = 0;
+    for (; k < n && !s_.empty(); ++k) out[k] = takeFront();
+    return k;
+  }
+  // Into a Queue of the same type over a list storage: one O(1) splice of the whole chain.
+  // Other sinks get batches.
+  std::size_t drain_into(IQueue<T>& sink) override {
+    if (&sink == this) return 0;
+    std::size_t n = s_.size();
+    if constexpr (requires(Storage& s) { s.splice_back(std::move(s)); }) {
+      if (auto* same = dynamic_cast<Queue*>(&sink)) {
+        same->s_.splice_back(std::move(s_));
+        return n;
+      }
+    }
+    return internal::drainBatched<T>(n, [this] { return takeFront(); },
+                                     [&sink](std::span<const T> xs) { sink.push_range(xs); });
+  }
+
   // Functional support: expose read-only iterators
   auto begin() const { return s_.begin(); }
   auto end() const { return s_.end(); }
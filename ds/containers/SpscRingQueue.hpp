@@ -0,0 +1,172 @@
+#pragma once
+#include "../interfaces/IQueue.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace ds {
+
+/**
+ * SpscRingQueue: Bounded lock-free queue for exactly one producer thread and one consumer thread.
+ * The capacity is rounded up to a power of two. Head (consumer) and tail (producer) sit on
+ * separate cache lines, each next to that side's cached copy of the other index, so a side
+ * only touches the other's line when its cached view says the queue is full / empty.
+ *
+ * IQueue semantics: enqueue / push_range throw std::length_error when the batch does not fit,
+ * as front / dequeue (consumer side) throw std::out_of_range on an empty queue, so a
+ * single-threaded IQueue caller can never hang on a full ring. A producer that should wait
+ * for its consumer calls enqueue_wait. size() is a snapshot. The try_ variants never wait;
+ * the bulk variants publish a whole batch with one release store.
+ */
+template <typename T>
+class SpscRingQueue final : public IQueue<T> {
+  static_assert(std::is_nothrow_move_constructible_v<T>, "queue elements must be nothrow movable");
+  static constexpr std::size_t kCacheLine = 64;
+
+  struct alignas(T) Slot {
+    unsigned char bytes[sizeof(T)];
+  };
+
+  std::unique_ptr<Slot[]> buf_;
+  std::size_t mask_;
+
+  alignas(kCacheLine) std::atomic<std::size_t> head_{0};   // next slot to read
+  mutable std::size_t tailCache_ = 0;                      // consumer's view of tail_
+  alignas(kCacheLine) std::atomic<std::size_t> tail_{0};   // next slot to write
+  std::size_t headCache_ = 0;                              // producer's view of head_
+
+  T* at(std::size_t i) const { return std::launder(reinterpret_cast<T*>(buf_[i & mask_].bytes)); }
+
+  // Free slots from the producer's side, refreshing the cached head only when needed.
+  std::size_t freeSlots(std::size_t tail, std::size_t want) {
+    std::size_t cap = mask_ + 1;
+    if (cap - (tail - headCache_) < want) headCache_ = head_.load(std::memory_order_acquire);
+    return cap - (tail - headCache_);
+  }
+
+  // Filled slots from the consumer's side.
+  std::size_t filledSlots(std::size_t head, std::size_t want) const {
+    if (tailCache_ - head < want) tailCache_ = tail_.load(std::memory_order_acquire);
+    return tailCache_ - head;
+  }
+
+  template <typename U>
+  bool put(U&& x) {
+    std::size_t tail = tail_.load(std::memory_order_relaxed);
+    if (freeSlots(tail, 1) == 0) return false;
+    ::new (static_cast<void*>(at(tail))) T(std::forward<U>(x));
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+public:
+  using value_type = T;
+
+  explicit SpscRingQueue(std::size_t capacity = 1024) {
+    std::size_t cap = 2;
+    while (cap < capacity) cap <<= 1;
+    buf_ = std::make_unique<Slot[]>(cap);
+    mask_ = cap - 1;
+  }
+  ~SpscRingQueue() override {
+    std::size_t tail = tail_.load(std::memory_order_relaxed);
+    for (std::size_t i = head_.load(std::memory_order_relaxed); i != tail; ++i) at(i)->~T();
+  }
+  SpscRingQueue(const SpscRingQueue&) = delete;
+  SpscRingQueue& operator=(const SpscRingQueue&) = delete;
+
+  std::size_t capacity() const { return mask_ + 1; }
+  std::size_t size() const override {
+    std::size_t head = head_.load(std::memory_order_acquire);
+    return tail_.load(std::memory_order_acquire) - head;
+  }
+  bool empty() const override { return size() == 0; }
+
+  // Producer side.
+  bool try_enqueue(const T& x) { return put(x); }
+  bool try_enqueue(T&& x) { return put(std::move(x)); }
+  template <typename... Args>
+  bool try_emplace(Args&&... args) {
+    std::size_t tail = tail_.load(std::memory_order_relaxed);
+    if (freeSlots(tail, 1) == 0) return false;
+    ::new (static_cast<void*>(at(tail))) T(std::forward<Args>(args)...);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+  // Moves up to n elements out of [first, first + n); returns how many were enqueued.
+  template <typename It>
+  std::size_t try_enqueue_bulk(It first, std::size_t n) {
+    std::size_t tail = tail_.load(std::memory_order_relaxed);
+    std::size_t count = std::min(n, freeSlots(tail, n));
+    for (std::size_t i = 0; i < count; ++i, ++first) ::new (static_cast<void*>(at(tail + i))) T(std::move(*first));
+    if (count) tail_.store(tail + count, std::memory_order_release);
+    return count;
+  }
+  // Waits (yielding) while the queue is full.
+  void enqueue_wait(const T& x) {
+    while (!put(x)) std::this_thread::yield();
+  }
+  void enqueue_wait(T&& x) {
+    while (!put(std::move(x))) std::this_thread::yield();
+  }
+  void enqueue(const T& x) override {
+    if (!put(x)) throw std::length_error("enqueue on full");
+  }
+  void enqueue(T&& x) override {
+    if (!put(std::move(x))) throw std::length_error("enqueue on full");
+  }
+  // All or nothing: throws, enqueueing none of xs, unless the whole span fits.
+  void push_range(std::span<const T> xs) override {
+    if (freeSlots(tail_.load(std::memory_order_relaxed), xs.size()) < xs.size()) {
+      throw std::length_error("push_range on full");
+    }
+    try_enqueue_bulk(xs.begin(), xs.size());
+  }
+
+  // Consumer side.
+  bool try_dequeue(T& out) {
+    std::size_t head = head_.load(std::memory_order_relaxed);
+    if (filledSlots(head, 1) == 0) return false;
+    T* p = at(head);
+    out = std::move(*p);
+    p->~T();
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+  // Moves up to max elements to out; returns how many were dequeued.
+  template <typename OutIt>
+  std::size_t try_dequeue_bulk(OutIt out, std::size_t max) {
+    std::size_t head = head_.load(std::memory_order_relaxed);
+    std::size_t count = std::min(max, filledSlots(head, max));
+    for (std::size_t i = 0; i < count; ++i) {
+      T* p = at(head + i);
+      *out = std::move(*p);
+      ++out;
+      p->~T();
+    }
+    if (count) head_.store(head + count, std::memory_order_release);
+    return count;
+  }
+  // Never waits: takes what is already published, up to n.
+  std::size_t pop_n(T* out, std::size_t n) override { return try_dequeue_bulk(out, n); }
+  void dequeue() override {
+    std::size_t head = head_.load(std::memory_order_relaxed);
+    if (filledSlots(head, 1) == 0) throw std::out_of_range("dequeue on empty");
+    at(head)->~T();
+    head_.store(head + 1, std::memory_order_release);
+  }
+  const T& front() const override {
+    std::size_t head = head_.load(std::memory_order_relaxed);
+    if (filledSlots(head, 1) == 0) throw std::out_of_range("front on empty");
+    return *at(head);
+  }
+};
+
+} // namespace ds
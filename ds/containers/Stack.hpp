@@ -2,6 +2,7 @@
 #include "../interfaces/IStack.hpp"
 #include "../storage/LinkedListStorage.hpp"
 #include "../concepts.hpp"
+#include <utility>
 
 namespace ds {
 
@@ -9,15 +10,49 @@ template <typename T, typename Storage = LinkedListStorage<T>>
 requires StackStorage<Storage, T>
 class Stack final : public IStack<T> {
   Storage s_;
+
+  T takeTop() {
+    if constexpr (requires(Storage& s) { s.take_back(); }) return s_.take_back();
+    else { T x = s_.back(); s_.pop_back(); return x; }
+  }
 public:
   using value_type = T;
 
   std::size_t size() const override { return s_.size(); }
   bool empty() const override { return s_.empty(); }
   void push(const T& x) override { s_.push_back(x); }
+  void push(T&& x) override { s_.push_back(std::move(x)); }
+  template <typename... Args>
+  requires requires(Storage& s, Args&&... args) { s.emplace_back(std::forward<Args>(args)...); }
+  void emplace(Args&&... args) { s_.emplace_back(std::forward<Args>(args)...); }
   void pop() override { s_.pop_back(); }
   const T& top() const override { return s_.back(); }
 
+  void push_range(std::span<const T> xs) override {
+    if constexpr (Reservable<Storage>) s_.reserve(s_.size() + xs.size());
+    for (const T& x : xs) s_.push_back(x);
+  }
+  std::size_t pop_n(T* out, std::size_t n) override {
+    std::size_t k = 0;
+    for (; k < n && !s_.empty(); ++k) out[k] = takeTop();
+    return k;
+  }
+  // Into a Stack of the same type over a list storage: the chain is reversed into pop order
+  // and spliced on, relinking nodes without copies. Other sinks get batches.
+  std::size_t drain_into(IStack<T>& sink) override {
+    if (&sink == this) return 0;
+    std::size_t n = s_.size();
+    if constexpr (requires(Storage& s) { s.reverse(); s.splice_back(std::move(s)); }) {
+      if (auto* same = dynamic_cast<Stack*>(&sink)) {
+        s_.reverse();
+        same->s_.splice_back(std::move(s_));
+        return n;
+      }
+    }
+    return internal::drainBatched<T>(n, [this] { return takeTop(); },
+                                     [&sink](std::span<const T> xs) { sink.push_range(xs); });
+  }
+
   // Functional support: expose read-only iterators
   auto begin() const { return s_.begin(); }
   auto end() const { return s_.end(); }
@@ -0,0 +1,118 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace ds {
+
+/**
+ * WorkStealingDeque: Chase-Lev deque for task scheduling. One owner thread pushes and pops at
+ * the bottom without locks (LIFO, cache-warm); any number of thief threads steal from the top
+ * (FIFO, oldest work first). Only the last element is contended: owner and thief settle it with
+ * one CAS on top. The circular array doubles when full; replaced arrays are kept until the deque
+ * is destroyed, because a thief may still be reading one.
+ *
+ * T must be trivially copyable (slots are atomics, so a thief may read a slot the owner is
+ * overwriting and simply lose its CAS); queue pointers or indices to larger tasks.
+ * Orderings follow Le et al., "Correct and Efficient Work-Stealing for Weak Memory Models"
+ * (PPoPP 2013), with the two fences folded into seq_cst operations on top and bottom.
+ */
+template <typename T>
+class WorkStealingDeque {
+  static_assert(std::is_trivially_copyable_v<T>, "store pointers or indices to non-trivial tasks");
+  static constexpr std::size_t kCacheLine = 64;
+
+  struct Array {
+    std::int64_t mask;
+    std::unique_ptr<std::atomic<T>[]> slots;
+
+    explicit Array(std::int64_t capacity) : mask(capacity - 1), slots(new std::atomic<T>[static_cast<std::size_t>(capacity)]) {}
+    std::int64_t capacity() const { return mask + 1; }
+    T get(std::int64_t i) const { return slots[static_cast<std::size_t>(i & mask)].load(std::memory_order_relaxed); }
+    void put(std::int64_t i, T x) { slots[static_cast<std::size_t>(i & mask)].store(x, std::memory_order_relaxed); }
+  };
+
+  alignas(kCacheLine) std::atomic<std::int64_t> top_{0};      // thieves' end
+  alignas(kCacheLine) std::atomic<std::int64_t> bottom_{0};   // owner's end
+  std::atomic<Array*> array_;
+  std::vector<std::unique_ptr<Array>> arrays_;                 // owner only: current and retired arrays
+
+  Array* grow(Array* a, std::int64_t top, std::int64_t bottom) {
+    auto bigger = std::make_unique<Array>(a->capacity() * 2);
+    for (std::int64_t i = top; i < bottom; ++i) bigger->put(i, a->get(i));
+    Array* raw = bigger.get();
+    arrays_.push_back(std::move(bigger));
+    array_.store(raw, std::memory_order_release);
+    return raw;
+  }
+
+public:
+  using value_type = T;
+
+  explicit WorkStealingDeque(std::size_t capacity = 256) {
+    std::int64_t cap = 2;
+    while (static_cast<std::size_t>(cap) < capacity) cap <<= 1;
+    arrays_.push_back(std::make_unique<Array>(cap));
+    array_.store(arrays_.back().get(), std::memory_order_relaxed);
+  }
+  WorkStealingDeque(const WorkStealingDeque&) = delete;
+  WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+  // Snapshot; exact only when no other thread is using the deque.
+  std::size_t size() const {
+    std::int64_t b = bottom_.load(std::memory_order_acquire);
+    std::int64_t t = top_.load(std::memory_order_acquire);
+    return b > t ? static_cast<std::size_t>(b - t) : 0;
+  }
+  bool empty() const { return size() == 0; }
+  std::size_t capacity() const { return static_cast<std::size_t>(array_.load(std::memory_order_acquire)->capacity()); }
+
+  // Owner only.
+  void push(T x) {
+    std::int64_t b = bottom_.load(std::memory_order_relaxed);
+    std::int64_t t = top_.load(std::memory_order_acquire);
+    Array* a = array_.load(std::memory_order_relaxed);
+    if (b - t > a->mask) a = grow(a, t, b);
+    a->put(b, x);
+    bottom_.store(b + 1, std::memory_order_release);
+  }
+
+  // Owner only: takes the most recently pushed element.
+  bool try_pop(T& out) {
+    std::int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+    Array* a = array_.load(std::memory_order_relaxed);
+    // Reserve the bottom slot before looking at top, so a thief cannot take it unseen.
+    bottom_.store(b, std::memory_order_seq_cst);
+    std::int64_t t = top_.load(std::memory_order_seq_cst);
+    if (t > b) {
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      return false;
+    }
+    T x = a->get(b);
+    if (t == b) {
+      // Last element: race the thieves for it.
+      bool won = top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      if (!won) return false;
+    }
+    out = x;
+    return true;
+  }
+
+  // Any thread: takes the oldest element. Fails when empty or when another thread won the race.
+  bool try_steal(T& out) {
+    std::int64_t t = top_.load(std::memory_order_seq_cst);
+    std::int64_t b = bottom_.load(std::memory_order_seq_cst);
+    if (t >= b) return false;
+    Array* a = array_.load(std::memory_order_acquire);
+    T x = a->get(t);
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) return false;
+    out = x;
+    return true;
+  }
+};
+
+} // namespace ds
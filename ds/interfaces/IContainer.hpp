@@ -1,5 +1,8 @@
 #pragma once
+#include <algorithm>
 #include <cstddef>
+#include <span>
+#include <vector>
 
 namespace ds {
 
@@ -9,5 +12,26 @@ struct IContainer {
   virtual bool empty() const = 0;
 };
 
-} // namespace ds
+// Batch operations (push_range / pop_n / drain_into on IStack, IQueue, IDeque, IPriorityQueue)
+// cost one virtual call per batch instead of one per element. The interface defaults loop over
+// the single-element virtuals and so copy elements out through the const accessors; containers
+// override them with storage calls that move elements out (take_front / take_back / take_top)
+// and, between containers of the same type, relink or merge the storages wholesale.
+namespace internal {
+  // Hands n elements to flush(span) in batches; next() yields them in pop order. Lets drain_into
+  // reach a sink of another type with one virtual push_range per batch instead of one per element.
+  template <typename T, typename Next, typename Flush>
+  std::size_t drainBatched(std::size_t n, Next next, Flush flush) {
+    constexpr std::size_t kBatch = 256;
+    std::vector<T> buf;
+    buf.reserve(std::min(n, kBatch));
+    for (std::size_t left = n; left > 0;) {
+      buf.clear();
+      for (; left > 0 && buf.size() < kBatch; --left) buf.push_back(next());
+      flush(std::span<const T>(buf));
+    }
+    return n;
+  }
+}
 
+} // namespace ds
@@ -8,11 +8,29 @@ struct IDeque : IContainer {
   virtual ~IDeque() = default;
   virtual void push_front(const T& x) = 0;
   virtual void push_back (const T& x) = 0;
+  virtual void push_front(T&& x) = 0;
+  virtual void push_back (T&& x) = 0;
   virtual void pop_front() = 0;
   virtual void pop_back () = 0;
   virtual const T& front() const = 0;
   virtual const T& back () const = 0;
+
+  // Appends xs at the back, in order.
+  virtual void push_range(std::span<const T> xs) {
+    for (const T& x : xs) push_back(x);
+  }
+  // Pops up to n elements from the front into out[0..n); returns how many.
+  virtual std::size_t pop_n(T* out, std::size_t n) {
+    std::size_t k = 0;
+    for (; k < n && !empty(); ++k) { out[k] = front(); pop_front(); }
+    return k;
+  }
+  // Pops everything onto the back of sink, order preserved; returns how many.
+  virtual std::size_t drain_into(IDeque& sink) {
+    if (&sink == this) return 0;
+    return internal::drainBatched<T>(size(), [this] { T x = front(); pop_front(); return x; },
+                                     [&sink](std::span<const T> xs) { sink.push_range(xs); });
+  }
 };
 
 } // namespace ds
-
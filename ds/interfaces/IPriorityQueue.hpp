@@ -7,9 +7,25 @@ template <typename T, typename Compare>
 struct IPriorityQueue : IContainer {
   virtual ~IPriorityQueue() = default;
   virtual void push(const T& x) = 0;
+  virtual void push(T&& x) = 0;
   virtual void pop() = 0;
   virtual const T& top() const = 0;
+
+  virtual void push_range(std::span<const T> xs) {
+    for (const T& x : xs) push(x);
+  }
+  // Pops up to n elements into out[0..n), best first; returns how many.
+  virtual std::size_t pop_n(T* out, std::size_t n) {
+    std::size_t k = 0;
+    for (; k < n && !empty(); ++k) { out[k] = top(); pop(); }
+    return k;
+  }
+  // Pops everything into sink; returns how many.
+  virtual std::size_t drain_into(IPriorityQueue& sink) {
+    if (&sink == this) return 0;
+    return internal::drainBatched<T>(size(), [this] { T x = top(); pop(); return x; },
+                                     [&sink](std::span<const T> xs) { sink.push_range(xs); });
+  }
 };
 
 } // namespace ds
-
@@ -7,9 +7,26 @@ template <typename T>
 struct IQueue : IContainer {
   virtual ~IQueue() = default;
   virtual void enqueue(const T& x) = 0;
+  virtual void enqueue(T&& x) = 0;
   virtual void dequeue() = 0;
   virtual const T& front() const = 0;
+
+  // Enqueues xs in order.
+  virtual void push_range(std::span<const T> xs) {
+    for (const T& x : xs) enqueue(x);
+  }
+  // Dequeues up to n elements into out[0..n), front first; returns how many.
+  virtual std::size_t pop_n(T* out, std::size_t n) {
+    std::size_t k = 0;
+    for (; k < n && !empty(); ++k) { out[k] = front(); dequeue(); }
+    return k;
+  }
+  // Dequeues everything onto the back of sink, order preserved; returns how many.
+  virtual std::size_t drain_into(IQueue& sink) {
+    if (&sink == this) return 0;
+    return internal::drainBatched<T>(size(), [this] { T x = front(); dequeue(); return x; },
+                                     [&sink](std::span<const T> xs) { sink.push_range(xs); });
+  }
 };
 
 } // namespace ds
-
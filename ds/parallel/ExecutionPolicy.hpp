@@ -0,0 +1,47 @@
+#pragma once
+#include <cstddef>
+#include <type_traits>
+#include "ThreadPool.hpp"
+
+namespace ds {
+
+namespace execution {
+
+struct sequenced_policy {};
+
+/**
+ * Parallel policy: algorithms split their input into chunks of at least `grain` elements
+ * and run them on `pool` (ThreadPool::global() when unset).
+ * The unsequenced flavour (par_unseq) is for now an alias of par: it dispatches the same way
+ * and no chunk body is vectorised. It exists so callers can already state that their
+ * callables are free of locks as well as of data races.
+ */
+template <bool Unsequenced>
+struct basic_parallel_policy {
+  ThreadPool* pool{nullptr};
+  std::size_t grain{4096};
+
+  constexpr basic_parallel_policy on(ThreadPool& p) const { auto c = *this; c.pool = &p; return c; }
+  constexpr basic_parallel_policy with_grain(std::size_t g) const { auto c = *this; c.grain = g ? g : 1; return c; }
+  ThreadPool& executor() const { return pool ? *pool : ThreadPool::global(); }
+};
+
+using parallel_policy = basic_parallel_policy<false>;
+using parallel_unsequenced_policy = basic_parallel_policy<true>;
+
+} // namespace execution
+
+template <typename P>
+concept ExecutionPolicy = std::is_same_v<std::remove_cvref_t<P>, execution::sequenced_policy> ||
+                          std::is_same_v<std::remove_cvref_t<P>, execution::parallel_policy> ||
+                          std::is_same_v<std::remove_cvref_t<P>, execution::parallel_unsequenced_policy>;
+
+template <typename P>
+concept ParallelPolicy = ExecutionPolicy<P> &&
+                         !std::is_same_v<std::remove_cvref_t<P>, execution::sequenced_policy>;
+
+inline constexpr execution::sequenced_policy seq{};
+inline constexpr execution::parallel_policy par{};
+inline constexpr execution::parallel_unsequenced_policy par_unseq{};
+
+} // namespace ds
@@ -0,0 +1,71 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "../containers/WorkStealingDeque.hpp"
+
+namespace ds {
+
+/**
+ * ThreadPool: Work-stealing pool for fork-join parallelism.
+ * Each worker owns a lock-free WorkStealingDeque: it pushes and pops at the bottom (LIFO,
+ * cache-warm) and idle workers steal from the top of other deques (FIFO, oldest and largest
+ * work first). Slot 0 is shared by all outside threads, so it stays a mutex-guarded deque.
+ * A pool of N threads spawns N-1 workers; the thread calling run() is the Nth and
+ * executes tasks while it waits, so nested run() calls cannot deadlock.
+ */
+class ThreadPool {
+public:
+  using Task = std::function<void()>;
+
+  explicit ThreadPool(std::size_t threads = std::thread::hardware_concurrency());
+  ~ThreadPool();
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  // Total parallelism, including the calling thread.
+  std::size_t size() const { return slots_.size(); }
+
+  // Fire-and-forget: queue a task on the current thread's deque.
+  void submit(Task task);
+
+  // Fork-join: calls fn(i) for every i in [0, count) and returns when all have finished.
+  // The first exception thrown by any fn(i) is rethrown here.
+  template <typename F>
+  void run(std::size_t count, F&& fn);
+
+  // Process-wide pool sized to the hardware.
+  static ThreadPool& global();
+
+private:
+  struct Slot {
+    std::mutex m;
+    std::deque<Task> tasks;             // slot 0 only
+    WorkStealingDeque<Task*> owned;     // workers' slots: pushed and popped by their own thread only
+  };
+
+  std::vector<std::unique_ptr<Slot>> slots_;   // slot 0 is shared by external threads
+  std::vector<std::thread> threads_;
+  std::atomic<std::size_t> queued_{0};
+  std::atomic<bool> stop_{false};
+  std::mutex sleepM_;
+  std::condition_variable sleepCv_;
+
+  std::size_t currentSlot() const;
+  void push(std::size_t slot, Task task);
+  void wake();
+  bool tryRunOne(std::size_t self);
+  void workerLoop(std::size_t slot);
+};
+
+} // namespace ds
+
+#include "ThreadPool.tpp"
@@ -0,0 +1,128 @@
+namespace ds {
+
+namespace internal {
+  // Which pool (if any) the current thread works for, and its slot there.
+  inline thread_local const ThreadPool* tlsPool = nullptr;
+  inline thread_local std::size_t tlsSlot = 0;
+}
+
+inline ThreadPool::ThreadPool(std::size_t threads) {
+  threads = std::max<std::size_t>(threads, 1);
+  for (std::size_t i = 0; i < threads; ++i) slots_.push_back(std::make_unique<Slot>());
+  for (std::size_t i = 1; i < threads; ++i) threads_.emplace_back([this, i] { workerLoop(i); });
+}
+
+inline ThreadPool::~ThreadPool() {
+  stop_.store(true);
+  wake();
+  for (auto& t : threads_) t.join();
+  // Submitted tasks nobody got to; no thief is left, so popping here is safe.
+  Task* task;
+  for (auto& slot : slots_) {
+    while (slot->owned.try_pop(task)) delete task;
+  }
+}
+
+inline ThreadPool& ThreadPool::global() {
+  static ThreadPool pool(std::thread::hardware_concurrency());
+  return pool;
+}
+
+inline std::size_t ThreadPool::currentSlot() const {
+  return internal::tlsPool == this ? internal::tlsSlot : 0;
+}
+
+// Only ever called with the caller's own slot (currentSlot()), so a worker's deque has one owner.
+inline void ThreadPool::push(std::size_t slot, Task task) {
+  if (slot == 0) {
+    std::lock_guard<std::mutex> lk(slots_[0]->m);
+    slots_[0]->tasks.push_back(std::move(task));
+  } else {
+    slots_[slot]->owned.push(new Task(std::move(task)));
+  }
+  queued_.fetch_add(1, std::memory_order_release);
+}
+
+inline void ThreadPool::wake() {
+  // Taking the lock orders this notify after any sleeper's predicate check.
+  { std::lock_guard<std::mutex> lk(sleepM_); }
+  sleepCv_.notify_all();
+}
+
+inline void ThreadPool::submit(Task task) {
+  push(currentSlot(), std::move(task));
+  wake();
+}
+
+inline bool ThreadPool::tryRunOne(std::size_t self) {
+  Task task;
+  Task* owned = nullptr;
+  if (self == 0) {
+    std::lock_guard<std::mutex> lk(slots_[0]->m);
+    if (!slots_[0]->tasks.empty()) {
+      task = std::move(slots_[0]->tasks.back());
+      slots_[0]->tasks.pop_back();
+    }
+  } else {
+    slots_[self]->owned.try_pop(owned);
+  }
+  for (std::size_t k = 1; !task && !owned && k < slots_.size(); ++k) {
+    std::size_t v = (self + k) % slots_.size();
+    if (v != 0) {
+      slots_[v]->owned.try_steal(owned);
+      continue;
+    }
+    std::lock_guard<std::mutex> lk(slots_[0]->m);
+    if (!slots_[0]->tasks.empty()) {
+      task = std::move(slots_[0]->tasks.front());
+      slots_[0]->tasks.pop_front();
+    }
+  }
+  if (owned) {
+    task = std::move(*owned);
+    delete owned;
+  }
+  if (!task) return false;
+  queued_.fetch_sub(1, std::memory_order_relaxed);
+  task();
+  return true;
+}
+
+inline void ThreadPool::workerLoop(std::size_t slot) {
+  internal::tlsPool = this;
+  internal::tlsSlot = slot;
+  while (!stop_.load(std::memory_order_relaxed)) {
+    if (tryRunOne(slot)) continue;
+    std::unique_lock<std::mutex> lk(sleepM_);
+    sleepCv_.wait(lk, [this] { return stop_.load() || queued_.load() > 0; });
+  }
+}
+
+template <typename F>
+void ThreadPool::run(std::size_t count, F&& fn) {
+  if (count == 0) return;
+  std::atomic<std::size_t> remaining{count};
+  std::exception_ptr error;
+  std::mutex errorM;
+  auto guarded = [&](std::size_t i) {
+    try {
+      fn(i);
+    } catch (...) {
+      std::lock_guard<std::mutex> lk(errorM);
+      if (!error) error = std::current_exception();
+    }
+    remaining.fetch_sub(1, std::memory_order_acq_rel);
+  };
+
+  std::size_t self = currentSlot();
+  // Pushed in reverse so the owner's LIFO pops walk the chunks in order while thieves take the far end.
+  for (std::size_t i = count; i-- > 1;) push(self, [&guarded, i] { guarded(i); });
+  if (count > 1) wake();
+  guarded(0);
+  while (remaining.load(std::memory_order_acquire) > 0) {
+    if (!tryRunOne(self)) std::this_thread::yield();
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+} // namespace ds
@@ -0,0 +1,75 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+
+/**
+ * Global allocation counters for profiling.
+ *
+ * The hooks are compiled in only when DS_PROFILE_ALLOCATIONS is defined before the first ds/
+ * include. Otherwise every hook is an empty inline function and snapshot() returns zeros, so
+ * storages can call them unconditionally at no cost.
+ *
+ * Two kinds of events are counted:
+ *   - heap allocations (count and bytes), reported by ds/profiling/CountingNew.hpp, which replaces
+ *     the global operator new when included in one translation unit;
+ *   - live container nodes, reported by the node-based storages (LinkedListStorage), with a
+ *     high-water mark that callers can reset around the region they measure.
+ */
+namespace ds::profiling {
+
+struct AllocSnapshot {
+  std::size_t allocations = 0;
+  std::size_t bytes = 0;
+  std::size_t liveNodes = 0;
+  std::size_t peakLiveNodes = 0;
+};
+
+#ifdef DS_PROFILE_ALLOCATIONS
+
+inline constexpr bool kAllocCountingEnabled = true;
+
+namespace internal {
+  inline std::atomic<std::size_t> allocations{0};
+  inline std::atomic<std::size_t> bytes{0};
+  inline std::atomic<std::size_t> liveNodes{0};
+  inline std::atomic<std::size_t> peakLiveNodes{0};
+}
+
+inline void countAllocation(std::size_t size) noexcept {
+  internal::allocations.fetch_add(1, std::memory_order_relaxed);
+  internal::bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+inline void nodeCreated() noexcept {
+  std::size_t live = internal::liveNodes.fetch_add(1, std::memory_order_relaxed) + 1;
+  std::size_t peak = internal::peakLiveNodes.load(std::memory_order_relaxed);
+  while (live > peak && !internal::peakLiveNodes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+}
+
+inline void nodesReleased(std::size_t n = 1) noexcept {
+  internal::liveNodes.fetch_sub(n, std::memory_order_relaxed);
+}
+
+// Restarts the high-water mark from the current number of live nodes.
+inline void resetPeak() noexcept {
+  internal::peakLiveNodes.store(internal::liveNodes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+inline AllocSnapshot snapshot() noexcept {
+  return {internal::allocations.load(std::memory_order_relaxed), internal::bytes.load(std::memory_order_relaxed),
+          internal::liveNodes.load(std::memory_order_relaxed), internal::peakLiveNodes.load(std::memory_order_relaxed)};
+}
+
+#else
+
+inline constexpr bool kAllocCountingEnabled = false;
+
+inline void countAllocation(std::size_t) noexcept {}
+inline void nodeCreated() noexcept {}
+inline void nodesReleased(std::size_t = 1) noexcept {}
+inline void resetPeak() noexcept {}
+inline AllocSnapshot snapshot() noexcept { return {}; }
+
+#endif
+
+} // namespace ds::profiling
@@ -0,0 +1,64 @@
+#pragma once
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include "AllocCounter.hpp"
+
+/**
+ * Replaces the global operator new/delete so every heap allocation reaches
+ * ds::profiling::countAllocation. Include it in exactly one translation unit of a program
+ * (the one with main), after defining DS_PROFILE_ALLOCATIONS; without that macro it
+ * defines nothing and the default allocator is untouched.
+ */
+#ifdef DS_PROFILE_ALLOCATIONS
+
+// Out of line on purpose: inlined into callers, GCC pairs the std::free in delete with the
+// operator new call site and reports -Wmismatched-new-delete at -O2.
+#define DS_COUNTING_NEW_API __attribute__((noinline))
+
+namespace ds::profiling::internal {
+  // The standard operator new loop: retry through the installed new_handler, bad_alloc without one.
+  template <typename Alloc>
+  void* allocateOrThrow(Alloc alloc) {
+    for (;;) {
+      if (void* p = alloc()) return p;
+      std::new_handler handler = std::get_new_handler();
+      if (!handler) throw std::bad_alloc{};
+      handler();
+    }
+  }
+}
+
+DS_COUNTING_NEW_API void* operator new(std::size_t size) {
+  ds::profiling::countAllocation(size);
+  return ds::profiling::internal::allocateOrThrow([size] { return std::malloc(size ? size : 1); });
+}
+
+DS_COUNTING_NEW_API void* operator new[](std::size_t size) {
+  return ::operator new(size);
+}
+
+DS_COUNTING_NEW_API void* operator new(std::size_t size, std::align_val_t align) {
+  ds::profiling::countAllocation(size);
+  std::size_t a = static_cast<std::size_t>(align);
+  // aligned_alloc wants the size rounded up to a multiple of the alignment.
+  std::size_t rounded = (size ? size + a - 1 : a) / a * a;
+  return ds::profiling::internal::allocateOrThrow([a, rounded] { return std::aligned_alloc(a, rounded); });
+}
+
+DS_COUNTING_NEW_API void* operator new[](std::size_t size, std::align_val_t align) {
+  return ::operator new(size, align);
+}
+
+DS_COUNTING_NEW_API void operator delete(void* p) noexcept { std::free(p); }
+DS_COUNTING_NEW_API void operator delete[](void* p) noexcept { std::free(p); }
+DS_COUNTING_NEW_API void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+DS_COUNTING_NEW_API void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+DS_COUNTING_NEW_API void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+DS_COUNTING_NEW_API void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+DS_COUNTING_NEW_API void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+DS_COUNTING_NEW_API void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+
+#undef DS_COUNTING_NEW_API
+
+#endif
@@ -0,0 +1,74 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "../concepts.hpp"
+
+namespace ds {
+
+/**
+ * DAryHeapStorage: Implicit D-ary heap in one vector (children of i are D*i+1 .. D*i+D).
+ * Compared with the binary VectorHeapStorage the tree is log2(D) times shallower, and the
+ * D children compared at each sift-down step share one or two cache lines. bench/bench_heap
+ * measures heapify faster at every size and pops about a third faster at 1e6 ints. At 1e7
+ * pops are bound by memory latency: D = 8 only matches the binary heap and D = 4 is about
+ * 20% slower. Same interface and ordering (Compare as in std::priority_queue: top() is the
+ * greatest under Compare); drop-in Storage for PriorityQueue.
+ */
+template <typename T, typename Compare, std::size_t D = 4>
+class DAryHeapStorage {
+  static_assert(D >= 2, "a heap needs at least two children per node");
+
+  std::vector<T> a_;
+  Compare cmp_;
+
+  void siftUp(std::size_t i);
+  void siftDown(std::size_t i);
+  void heapify();
+  template <std::size_t K> std::size_t bestOf(std::size_t first) const;
+
+public:
+  using value_type = T;
+  using const_iterator = typename std::vector<T>::const_iterator;
+  static constexpr std::size_t arity = D;
+
+  DAryHeapStorage() = default;
+  explicit DAryHeapStorage(Compare c) : cmp_(c) {}
+
+  // Bulk construction: copies the range, then heapifies bottom-up in O(N).
+  template <typename It> DAryHeapStorage(It first, It last, Compare c = Compare{});
+  DAryHeapStorage(std::initializer_list<T> init, Compare c = Compare{});
+  template <typename Range>
+  requires Iterable<Range> && (!std::is_same_v<std::remove_cvref_t<Range>, DAryHeapStorage>)
+  explicit DAryHeapStorage(const Range& r, Compare c = Compare{});
+
+  void push(const T& x);
+  void push(T&& x);
+  template <typename... Args> void emplace(Args&&... args);
+  // Appends a range with one reservation; same heuristic as VectorHeapStorage::push_range.
+  template <typename It> void push_range(It first, It last);
+  template <typename Range> requires Iterable<Range> void push_range(const Range& r);
+  // Moves all of other's elements in and leaves other empty.
+  void merge(DAryHeapStorage&& other);
+  void reserve(std::size_t n) { a_.reserve(n); }
+  void clear() { a_.clear(); }
+  void pop();
+  const T& top() const;
+  // Pop that moves the top element out instead of leaving a copy to the caller.
+  T take_top();
+  std::size_t size() const { return a_.size(); }
+  bool empty() const { return a_.empty(); }
+
+  // Iterator support for functional algorithms (Read-Only traversal)
+  // Note: Iteration order is the heap layout, not sorted.
+  const_iterator begin() const { return a_.begin(); }
+  const_iterator end() const { return a_.end(); }
+};
+
+} // namespace ds
+
+#include "DAryHeapStorage.tpp"
@@ -0,0 +1,175 @@
+namespace ds {
+
+// Moves the hole up instead of swapping: one move per level.
+template <typename T, typename Compare, std::size_t D>
+void DAryHeapStorage<T, Compare, D>::siftUp(std::size_t i) {
+  T x = std::move(a_[i]);
+  while (i > 0) {
+    std::size_t parent = (i - 1) / D;
+    if (!cmp_(a_[parent], x)) break;
+    a_[i] = std::move(a_[parent]);
+    i = parent;
+  }
+  a_[i] = std::move(x);
+}
+
+template <typename T, typename Compare, std::size_t D>
+void DAryHeapStorage<T, Compare, D>::siftDown(std::size_t i) {
+  const std::size_t n = a_.size();
+  T x = std::move(a_[i]);
+  for (;;) {
+    std::size_t first = D * i + 1;
+    if (first >= n) break;
+    std::size_t last = std::min(first + D, n);
+    std::size_t best = first;
+    for (std::size_t c = first + 1; c < last; ++c) {
+      if (cmp_(a_[best], a_[c])) best = c;
+    }
+    if (!cmp_(x, a_[best])) break;
+    a_[i] = std::move(a_[best]);
+    i = best;
+  }
+  a_[i] = std::move(x);
+}
+
+// Floyd's bottom-up construction: sift down every internal node, last one first.
+template <typename T, typename Compare, std::size_t D>
+void DAryHeapStorage<T, Compare, D>::heapify() {
+  if (a_.size() < 2) return;
+  for (std::size_t i = (a_.size() - 2) / D + 1; i-- > 0;) siftDown(i);
+}
+
+template <typename T, typename Compare, std::size_t D>
+template <typename It>
+DAryHeapStorage<T, Compare, D>::DAryHeapStorage(It first, It last, Compare c) : a_(first, last), cmp_(c) {
+  heapify();
+}
+
+template <typename T, typename Compare, std::size_t D>
+DAryHeapStorage<T, Compare, D>::DAryHeapStorage(std::initializer_list<T> init, Compare c)
+    : DAryHeapStorage(init.begin(), init.end(), c) {}
+
+template <typename T, typename Compare, std::size_t D>
+template <typename Range>
+requires Iterable<Range> && (!std::is_same_v<std::remove_cvref_t<Range>, DAryHeapStorage<T, Compare, D>>)
+DAryHeapStorage<T, Compare, D>::DAryHeapStorage(const Range& r, Compare c)
+    : DAryHeapStorage(r.begin(), r.end(), c) {}
+
+template <typename T, typename Compare, std::size_t D>
+void DAryHeapStorage<T, Compare, D>::push(const T& x) {
+  a_.push_back(x);
+  siftUp(a_.size() - 1);
+}
+
+template <typename T, typename Compare, std::size_t D>
+void DAryHeapStorage<T, Compare, D>::push(T&& x) {
+  a_.push_back(std::move(x));
+  siftUp(a_.size() - 1);
+}
+
+template <typename T, typename Compare, std::size_t D>
+template <typename... Args>
+void DAryHeapStorage<T, Compare, D>::emplace(Args&&... args) {
+  a_.emplace_back(std::forward<Args>(args)...);
+  siftUp(a_.size() - 1);
+}
+
+template <typename T, typename Compare, std::size_t D>
+template <typename It>
+void DAryHeapStorage<T, Compare, D>::push_range(It first, It last) {
+  std::size_t old = a_.size();
+  if constexpr (std::forward_iterator<It>) {
+    a_.reserve(old + static_cast<std::size_t>(std::distance(first, last)));
+  }
+  a_.insert(a_.end(), first, last);
+  std::size_t added = a_.size() - old;
+  std::size_t logN = 1;
+  while ((std::size_t{1} << logN) < a_.size()) ++logN;
+  if (added * logN < a_.size()) {
+    for (std::size_t i = old; i < a_.size(); ++i) siftUp(i);
+  } else {
+    heapify();
+  }
+}
+
+template <typename T, typename Compare, std::size_t D>
+template <typename Range>
+requires Iterable<Range>
+void DAryHeapStorage<T, Compare, D>::push_range(const Range& r) {
+  push_range(r.begin(), r.end());
+}
+
+template <typename T, typename Compare, std::size_t D>
+void DAryHeapStorage<T, Compare, D>::merge(DAryHeapStorage&& other) {
+  if (&other == this) return;
+  push_range(std::make_move_iterator(other.a_.begin()), std::make_move_iterator(other.a_.end()));
+  other.a_.clear();
+}
+
+// Index of the best of a_[first, first + K), as a tournament: the two halves are independent,
+// so their comparisons overlap instead of forming one serial chain of K - 1.
+template <typename T, typename Compare, std::size_t D>
+template <std::size_t K>
+std::size_t DAryHeapStorage<T, Compare, D>::bestOf(std::size_t first) const {
+  if constexpr (K == 1) {
+    return first;
+  } else {
+    std::size_t l = bestOf<K / 2>(first);
+    std::size_t r = bestOf<K - K / 2>(first + K / 2);
+    // Select with a mask, not a branch: which child wins is a coin flip on random keys.
+    std::size_t takeRight = 0 - static_cast<std::size_t>(cmp_(a_[l], a_[r]));
+    return l ^ ((l ^ r) & takeRight);
+  }
+}
+
+// Bottom-up pop (as in std::pop_heap): walk the hole from the root to a leaf along the best
+// children without comparing against the moved-in value, then sift that value up from the leaf.
+// The last element is usually small, so the final sift-up is short and each level costs D - 1
+// comparisons instead of D.
+template <typename T, typename Compare, std::size_t D>
+void DAryHeapStorage<T, Compare, D>::pop() {
+  if (a_.empty()) throw std::out_of_range("pop on empty");
+  T x = std::move(a_.back());
+  a_.pop_back();
+  const std::size_t n = a_.size();
+  if (n == 0) return;
+  std::size_t hole = 0;
+  for (;;) {
+    std::size_t first = D * hole + 1;
+    if (first >= n) break;
+    std::size_t best = first;
+    if (first + D <= n) {
+#if defined(__GNUC__) || defined(__clang__)
+      // The children of all D candidates are one contiguous block of D * D slots: start loading
+      // it now, so the next level does not wait on memory once this one picks its winner.
+      constexpr std::size_t perLine = sizeof(T) >= 64 ? 1 : 64 / sizeof(T);
+      std::size_t grand = D * first + 1;
+      for (std::size_t g = grand; g < std::min(grand + D * D, n); g += perLine) __builtin_prefetch(a_.data() + g);
+#endif
+      best = bestOf<D>(first);
+    } else {
+      for (std::size_t c = first + 1; c < n; ++c) best = cmp_(a_[best], a_[c]) ? c : best;
+    }
+    a_[hole] = std::move(a_[best]);
+    hole = best;
+  }
+  a_[hole] = std::move(x);
+  siftUp(hole);
+}
+
+template <typename T, typename Compare, std::size_t D>
+const T& DAryHeapStorage<T, Compare, D>::top() const {
+  if (a_.empty()) throw std::out_of_range("top on empty");
+  return a_.front();
+}
+
+// pop() never reads the root (it is the first hole), so the top can be moved out beforehand.
+template <typename T, typename Compare, std::size_t D>
+T DAryHeapStorage<T, Compare, D>::take_top() {
+  if (a_.empty()) throw std::out_of_range("take_top on empty");
+  T x = std::move(a_.front());
+  pop();
+  return x;
+}
+
+} // namespace ds
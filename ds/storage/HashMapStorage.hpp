@@ -0,0 +1,136 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+namespace ds {
+
+/**
+ * StringHash: Transparent hash for string keys, so a HashMapStorage<std::string, V, StringHash,
+ * std::equal_to<>> can be probed with std::string_view or const char* without building a string.
+ */
+struct StringHash {
+  using is_transparent = void;
+  std::size_t operator()(std::string_view s) const { return std::hash<std::string_view>{}(s); }
+};
+
+/**
+ * HashMapStorage: Open-addressing hash table (linear probing, power-of-two capacity).
+ * Entries live inline in one flat array next to a parallel array of cached hashes, so a
+ * lookup touches one or two cache lines instead of chasing bucket nodes. Erase uses
+ * backward shifting, so there are no tombstones. Load factor stays at or below 3/4.
+ * Iteration order is unspecified; keys must not be modified through an iterator.
+ */
+template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class HashMapStorage {
+public:
+  using key_type = K;
+  using mapped_type = V;
+  using value_type = std::pair<K, V>;
+
+private:
+  using Traits = std::allocator_traits<std::allocator<value_type>>;
+
+  value_type* slots_{nullptr};
+  std::size_t* hashes_{nullptr};   // 0 marks an empty slot; stored hashes are never 0
+  std::size_t cap_{0};             // always 0 or a power of two
+  std::size_t n_{0};
+  int shift_{std::numeric_limits<std::size_t>::digits};
+  [[no_unique_address]] Hash hash_;
+  [[no_unique_address]] KeyEqual eq_;
+  [[no_unique_address]] std::allocator<value_type> alloc_;
+
+  static constexpr bool transparent = requires { typename Hash::is_transparent; typename KeyEqual::is_transparent; };
+
+  std::size_t mask() const { return cap_ - 1; }
+  std::size_t next(std::size_t i) const { return (i + 1) & mask(); }
+  // Fibonacci hashing: the top bits of the product spread weak hashes (e.g. identity on ints).
+  std::size_t home(std::size_t h) const { return h >> shift_; }
+  template <typename Q> std::size_t hashOf(const Q& key) const {
+    std::size_t h = static_cast<std::size_t>(hash_(key) * UINT64_C(0x9E3779B97F4A7C15));
+    return h ? h : 1;
+  }
+  template <typename Q> std::size_t locate(const Q& key, std::size_t h) const;
+  template <typename Q, typename... Args> std::pair<std::size_t, bool> insertUnique(Q&& key, Args&&... args);
+  void rehash(std::size_t newCap);
+  void release();
+
+public:
+  HashMapStorage() = default;
+  ~HashMapStorage();
+
+  // Rule of 5: Enable Copy and Move
+  HashMapStorage(const HashMapStorage& other);
+  HashMapStorage(HashMapStorage&& other) noexcept;
+  HashMapStorage& operator=(const HashMapStorage& other);
+  HashMapStorage& operator=(HashMapStorage&& other) noexcept;
+
+  // Iterator Support: walks the occupied slots
+  class Iterator {
+      const HashMapStorage* map_;
+      std::size_t i_;
+      void skip() { while (i_ < map_->cap_ && map_->hashes_[i_] == 0) ++i_; }
+  public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = HashMapStorage::value_type;
+      using difference_type = std::ptrdiff_t;
+      using pointer = value_type*;
+      using reference = value_type&;
+
+      Iterator(const HashMapStorage* map = nullptr, std::size_t i = 0) : map_(map), i_(i) { if (map_) skip(); }
+
+      value_type& operator*() const { return map_->slots_[i_]; }
+      value_type* operator->() const { return map_->slots_ + i_; }
+      Iterator& operator++() { ++i_; skip(); return *this; }
+      Iterator operator++(int) { Iterator tmp = *this; ++*this; return tmp; }
+
+      bool operator==(const Iterator& other) const { return i_ == other.i_; }
+      bool operator!=(const Iterator& other) const { return i_ != other.i_; }
+  };
+
+  Iterator begin() const { return Iterator(this, 0); }
+  Iterator end() const { return Iterator(this, cap_); }
+
+  // Lookup. The templated overloads accept any key type when Hash and KeyEqual are transparent.
+  Iterator find(const K& key) const { return Iterator(this, locate(key, hashOf(key))); }
+  template <typename Q> requires transparent
+  Iterator find(const Q& key) const { return Iterator(this, locate(key, hashOf(key))); }
+  bool contains(const K& key) const { return find(key) != end(); }
+  template <typename Q> requires transparent
+  bool contains(const Q& key) const { return find(key) != end(); }
+  V& at(const K& key);
+  const V& at(const K& key) const;
+
+  // Insertion: inserts a default-constructed value if the key is absent.
+  // (The slot index is taken before indexing slots_, which an insert may reallocate.)
+  V& operator[](const K& key) { std::size_t i = insertUnique(key).first; return slots_[i].second; }
+  V& operator[](K&& key) { std::size_t i = insertUnique(std::move(key)).first; return slots_[i].second; }
+  template <typename Q> requires transparent
+  V& operator[](Q&& key) { std::size_t i = insertUnique(std::forward<Q>(key)).first; return slots_[i].second; }
+
+  // Constructs the value from args only when the key is absent; returns {entry, inserted}.
+  template <typename... Args> std::pair<Iterator, bool> try_emplace(const K& key, Args&&... args);
+  template <typename... Args> std::pair<Iterator, bool> try_emplace(K&& key, Args&&... args);
+
+  std::size_t erase(const K& key);
+  void clear();
+  // Makes room for n entries without further rehashing.
+  void reserve(std::size_t n);
+  std::size_t capacity() const { return cap_; }
+  std::size_t size() const { return n_; }
+  bool empty() const { return n_ == 0; }
+};
+
+} // namespace ds
+
+#include "HashMapStorage.tpp"
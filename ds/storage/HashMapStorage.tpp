@@ -0,0 +1,198 @@
+namespace ds {
+
+template <typename K, typename V, typename H, typename E>
+HashMapStorage<K, V, H, E>::~HashMapStorage() {
+  release();
+}
+
+// Copy Constructor: same capacity, so every entry keeps its slot
+template <typename K, typename V, typename H, typename E>
+HashMapStorage<K, V, H, E>::HashMapStorage(const HashMapStorage& other)
+    : hash_(other.hash_), eq_(other.eq_) {
+  if (!other.cap_) return;
+  rehash(other.cap_);
+  for (std::size_t i = 0; i < cap_; ++i) {
+    if (other.hashes_[i] == 0) continue;
+    Traits::construct(alloc_, slots_ + i, other.slots_[i]);
+    hashes_[i] = other.hashes_[i];
+    ++n_;
+  }
+}
+
+// Move Constructor
+template <typename K, typename V, typename H, typename E>
+HashMapStorage<K, V, H, E>::HashMapStorage(HashMapStorage&& other) noexcept
+    : slots_(other.slots_), hashes_(other.hashes_), cap_(other.cap_), n_(other.n_), shift_(other.shift_),
+      hash_(std::move(other.hash_)), eq_(std::move(other.eq_)) {
+  other.slots_ = nullptr;
+  other.hashes_ = nullptr;
+  other.cap_ = other.n_ = 0;
+  other.shift_ = std::numeric_limits<std::size_t>::digits;
+}
+
+// Copy Assignment
+template <typename K, typename V, typename H, typename E>
+HashMapStorage<K, V, H, E>& HashMapStorage<K, V, H, E>::operator=(const HashMapStorage& other) {
+  if (this != &other) {
+    HashMapStorage copy(other);
+    *this = std::move(copy);
+  }
+  return *this;
+}
+
+// Move Assignment
+template <typename K, typename V, typename H, typename E>
+HashMapStorage<K, V, H, E>& HashMapStorage<K, V, H, E>::operator=(HashMapStorage&& other) noexcept {
+  if (this != &other) {
+    release();
+    slots_ = other.slots_; hashes_ = other.hashes_; cap_ = other.cap_; n_ = other.n_; shift_ = other.shift_;
+    hash_ = std::move(other.hash_); eq_ = std::move(other.eq_);
+    other.slots_ = nullptr;
+    other.hashes_ = nullptr;
+    other.cap_ = other.n_ = 0;
+    other.shift_ = std::numeric_limits<std::size_t>::digits;
+  }
+  return *this;
+}
+
+template <typename K, typename V, typename H, typename E>
+void HashMapStorage<K, V, H, E>::release() {
+  clear();
+  if (slots_) Traits::deallocate(alloc_, slots_, cap_);
+  if (hashes_) std::allocator<std::size_t>().deallocate(hashes_, cap_);
+  slots_ = nullptr;
+  hashes_ = nullptr;
+  cap_ = 0;
+  shift_ = std::numeric_limits<std::size_t>::digits;
+}
+
+// Returns the slot holding key, or cap_ when it is absent.
+template <typename K, typename V, typename H, typename E>
+template <typename Q>
+std::size_t HashMapStorage<K, V, H, E>::locate(const Q& key, std::size_t h) const {
+  if (n_ == 0) return cap_;
+  for (std::size_t i = home(h);; i = next(i)) {
+    if (hashes_[i] == 0) return cap_;
+    if (hashes_[i] == h && eq_(slots_[i].first, key)) return i;
+  }
+}
+
+// Finds key or inserts it with a value built from args; returns {slot, inserted}.
+template <typename K, typename V, typename H, typename E>
+template <typename Q, typename... Args>
+std::pair<std::size_t, bool> HashMapStorage<K, V, H, E>::insertUnique(Q&& key, Args&&... args) {
+  std::size_t h = hashOf(key);
+  std::size_t found = locate(key, h);
+  if (found != cap_) return {found, false};
+
+  if ((n_ + 1) * 4 > cap_ * 3) rehash(cap_ ? cap_ * 2 : 8);
+  std::size_t i = home(h);
+  while (hashes_[i] != 0) i = next(i);
+  Traits::construct(alloc_, slots_ + i, std::piecewise_construct,
+                    std::forward_as_tuple(std::forward<Q>(key)),
+                    std::forward_as_tuple(std::forward<Args>(args)...));
+  hashes_[i] = h;
+  ++n_;
+  return {i, true};
+}
+
+// Moves every entry into fresh arrays of newCap slots; cached hashes avoid rehashing keys.
+template <typename K, typename V, typename H, typename E>
+void HashMapStorage<K, V, H, E>::rehash(std::size_t newCap) {
+  value_type* oldSlots = slots_;
+  std::size_t* oldHashes = hashes_;
+  std::size_t oldCap = cap_;
+
+  std::allocator<std::size_t> hashAlloc;
+  std::size_t* nh = hashAlloc.allocate(newCap);
+  value_type* ns;
+  try {
+    ns = Traits::allocate(alloc_, newCap);
+  } catch (...) {
+    hashAlloc.deallocate(nh, newCap);
+    throw;
+  }
+  std::fill(nh, nh + newCap, std::size_t{0});
+  slots_ = ns; hashes_ = nh; cap_ = newCap;
+  shift_ = std::numeric_limits<std::size_t>::digits - std::countr_zero(newCap);
+
+  for (std::size_t j = 0; j < oldCap; ++j) {
+    if (oldHashes[j] == 0) continue;
+    std::size_t i = home(oldHashes[j]);
+    while (hashes_[i] != 0) i = next(i);
+    Traits::construct(alloc_, slots_ + i, std::move(oldSlots[j]));
+    Traits::destroy(alloc_, oldSlots + j);
+    hashes_[i] = oldHashes[j];
+  }
+  if (oldSlots) Traits::deallocate(alloc_, oldSlots, oldCap);
+  if (oldHashes) hashAlloc.deallocate(oldHashes, oldCap);
+}
+
+template <typename K, typename V, typename H, typename E>
+void HashMapStorage<K, V, H, E>::reserve(std::size_t n) {
+  std::size_t needed = std::bit_ceil(std::max<std::size_t>(8, (n * 4 + 2) / 3));
+  if (needed > cap_) rehash(needed);
+}
+
+template <typename K, typename V, typename H, typename E>
+void HashMapStorage<K, V, H, E>::clear() {
+  for (std::size_t i = 0; n_ > 0 && i < cap_; ++i) {
+    if (hashes_[i] == 0) continue;
+    Traits::destroy(alloc_, slots_ + i);
+    hashes_[i] = 0;
+    --n_;
+  }
+}
+
+template <typename K, typename V, typename H, typename E>
+V& HashMapStorage<K, V, H, E>::at(const K& key) {
+  std::size_t i = locate(key, hashOf(key));
+  if (i == cap_) throw std::out_of_range("at: key not found");
+  return slots_[i].second;
+}
+
+template <typename K, typename V, typename H, typename E>
+const V& HashMapStorage<K, V, H, E>::at(const K& key) const {
+  std::size_t i = locate(key, hashOf(key));
+  if (i == cap_) throw std::out_of_range("at: key not found");
+  return slots_[i].second;
+}
+
+template <typename K, typename V, typename H, typename E>
+template <typename... Args>
+auto HashMapStorage<K, V, H, E>::try_emplace(const K& key, Args&&... args) -> std::pair<Iterator, bool> {
+  auto [i, inserted] = insertUnique(key, std::forward<Args>(args)...);
+  return {Iterator(this, i), inserted};
+}
+
+template <typename K, typename V, typename H, typename E>
+template <typename... Args>
+auto HashMapStorage<K, V, H, E>::try_emplace(K&& key, Args&&... args) -> std::pair<Iterator, bool> {
+  auto [i, inserted] = insertUnique(std::move(key), std::forward<Args>(args)...);
+  return {Iterator(this, i), inserted};
+}
+
+// Backward-shift deletion: later entries of the probe run slide into the hole when that
+// keeps them at or after their home slot, so lookups never need tombstones.
+template <typename K, typename V, typename H, typename E>
+std::size_t HashMapStorage<K, V, H, E>::erase(const K& key) {
+  std::size_t hole = locate(key, hashOf(key));
+  if (hole == cap_) return 0;
+  Traits::destroy(alloc_, slots_ + hole);
+  hashes_[hole] = 0;
+  --n_;
+
+  for (std::size_t j = next(hole); hashes_[j] != 0; j = next(j)) {
+    std::size_t distHome = (j - home(hashes_[j])) & mask();
+    std::size_t distHole = (j - hole) & mask();
+    if (distHome < distHole) continue;
+    Traits::construct(alloc_, slots_ + hole, std::move(slots_[j]));
+    Traits::destroy(alloc_, slots_ + j);
+    hashes_[hole] = hashes_[j];
+    hashes_[j] = 0;
+    hole = j;
+  }
+  return 1;
+}
+
+} // namespace ds
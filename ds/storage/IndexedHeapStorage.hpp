@@ -0,0 +1,94 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include "../concepts.hpp"
+
+namespace ds {
+
+/**
+ * IndexedHeapStorage: Addressable binary heap. push returns a handle that names the element
+ * until it is popped or erased, and update / erase / contains work on that handle in O(log N)
+ * (O(1) for contains). Same ordering as VectorHeapStorage (top() is the greatest under Compare),
+ * so it is a drop-in Storage for PriorityQueue; AddressablePriorityQueue exposes the handles.
+ *
+ * Values stay contiguous in heap order (comparisons never chase an index); a parallel array
+ * records each position's slot and pos_ maps a slot back to its position. Slots of removed
+ * elements are reused by later pushes; a handle also carries its slot's generation, which
+ * moves on when the element leaves, so a stale handle is !contains and throws instead of
+ * naming whatever element reused the slot.
+ */
+template <typename T, typename Compare>
+class IndexedHeapStorage {
+  static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+  std::vector<T> a_;                // values in heap order
+  std::vector<std::size_t> slot_;   // slot_[i]: slot of a_[i]
+  std::vector<std::size_t> pos_;    // pos_[s]: position of slot s, npos when free
+  std::vector<std::uint32_t> gen_;  // gen_[s]: generation of slot s, bumped on release
+  std::vector<std::size_t> free_;   // released slots
+  Compare cmp_;
+
+public:
+  struct Handle {
+    std::uint32_t slot = std::numeric_limits<std::uint32_t>::max();   // default: names nothing
+    std::uint32_t generation = 0;
+    bool operator==(const Handle&) const = default;
+  };
+
+private:
+  std::size_t acquire();
+  Handle insert(T&& x);
+  void siftUp(std::size_t i);
+  void siftDown(std::size_t i);
+  void removeAt(std::size_t i);
+  std::size_t checked(Handle h) const;
+
+public:
+  using value_type = T;
+  using handle_type = Handle;
+  using const_iterator = typename std::vector<T>::const_iterator;
+
+  IndexedHeapStorage() = default;
+  explicit IndexedHeapStorage(Compare c) : cmp_(c) {}
+
+  // Bulk construction in O(N); the element at input position i gets slot i, generation 0.
+  template <typename It> IndexedHeapStorage(It first, It last, Compare c = Compare{});
+  IndexedHeapStorage(std::initializer_list<T> init, Compare c = Compare{});
+
+  handle_type push(const T& x);
+  handle_type push(T&& x);
+  template <typename... Args> handle_type emplace(Args&&... args);
+  void pop();
+  const T& top() const;
+  // Pop that moves the top element out instead of leaving a copy to the caller.
+  T take_top();
+  handle_type top_handle() const;
+
+  // Replaces the value behind h and restores the heap in whichever direction it moved.
+  void update(handle_type h, const T& x);
+  void update(handle_type h, T&& x);
+  void erase(handle_type h);
+  bool contains(handle_type h) const {
+    return h.slot < pos_.size() && pos_[h.slot] != npos && gen_[h.slot] == h.generation;
+  }
+  const T& value(handle_type h) const { return a_[checked(h)]; }
+
+  void reserve(std::size_t n);
+  std::size_t size() const { return a_.size(); }
+  bool empty() const { return a_.empty(); }
+
+  // Iterator support for functional algorithms (Read-Only traversal)
+  // Note: Iteration order is the heap layout, not sorted.
+  const_iterator begin() const { return a_.begin(); }
+  const_iterator end() const { return a_.end(); }
+};
+
+} // namespace ds
+
+#include "IndexedHeapStorage.tpp"
@@ -0,0 +1,172 @@
+namespace ds {
+
+template <typename T, typename Compare>
+std::size_t IndexedHeapStorage<T, Compare>::acquire() {
+  if (!free_.empty()) {
+    std::size_t s = free_.back();
+    free_.pop_back();
+    return s;
+  }
+  pos_.push_back(npos);
+  gen_.push_back(0);
+  return pos_.size() - 1;
+}
+
+template <typename T, typename Compare>
+auto IndexedHeapStorage<T, Compare>::insert(T&& x) -> Handle {
+  std::size_t s = acquire();
+  a_.push_back(std::move(x));
+  slot_.push_back(s);
+  pos_[s] = a_.size() - 1;
+  siftUp(a_.size() - 1);
+  return Handle{static_cast<std::uint32_t>(s), gen_[s]};
+}
+
+// Both sifts move a hole instead of swapping, fixing pos_ for every element they shift.
+template <typename T, typename Compare>
+void IndexedHeapStorage<T, Compare>::siftUp(std::size_t i) {
+  T x = std::move(a_[i]);
+  std::size_t h = slot_[i];
+  while (i > 0) {
+    std::size_t parent = (i - 1) / 2;
+    if (!cmp_(a_[parent], x)) break;
+    a_[i] = std::move(a_[parent]);
+    slot_[i] = slot_[parent];
+    pos_[slot_[i]] = i;
+    i = parent;
+  }
+  a_[i] = std::move(x);
+  slot_[i] = h;
+  pos_[h] = i;
+}
+
+template <typename T, typename Compare>
+void IndexedHeapStorage<T, Compare>::siftDown(std::size_t i) {
+  const std::size_t n = a_.size();
+  T x = std::move(a_[i]);
+  std::size_t h = slot_[i];
+  for (;;) {
+    std::size_t child = 2 * i + 1;
+    if (child >= n) break;
+    if (child + 1 < n && cmp_(a_[child], a_[child + 1])) ++child;
+    if (!cmp_(x, a_[child])) break;
+    a_[i] = std::move(a_[child]);
+    slot_[i] = slot_[child];
+    pos_[slot_[i]] = i;
+    i = child;
+  }
+  a_[i] = std::move(x);
+  slot_[i] = h;
+  pos_[h] = i;
+}
+
+// Fills position i with the last element, which may then belong above or below i.
+template <typename T, typename Compare>
+void IndexedHeapStorage<T, Compare>::removeAt(std::size_t i) {
+  std::size_t s = slot_[i];
+  pos_[s] = npos;
+  ++gen_[s];
+  free_.push_back(s);
+  std::size_t last = a_.size() - 1;
+  if (i != last) {
+    a_[i] = std::move(a_[last]);
+    slot_[i] = slot_[last];
+    pos_[slot_[i]] = i;
+  }
+  a_.pop_back();
+  slot_.pop_back();
+  if (i >= a_.size()) return;
+  if (i > 0 && cmp_(a_[(i - 1) / 2], a_[i])) siftUp(i);
+  else siftDown(i);
+}
+
+template <typename T, typename Compare>
+std::size_t IndexedHeapStorage<T, Compare>::checked(Handle h) const {
+  if (!contains(h)) throw std::out_of_range("handle not in heap");
+  return pos_[h.slot];
+}
+
+template <typename T, typename Compare>
+template <typename It>
+IndexedHeapStorage<T, Compare>::IndexedHeapStorage(It first, It last, Compare c) : a_(first, last), cmp_(c) {
+  slot_.resize(a_.size());
+  pos_.resize(a_.size());
+  gen_.assign(a_.size(), 0);
+  for (std::size_t i = 0; i < a_.size(); ++i) slot_[i] = pos_[i] = i;
+  for (std::size_t i = a_.size() / 2; i-- > 0;) siftDown(i);
+}
+
+template <typename T, typename Compare>
+IndexedHeapStorage<T, Compare>::IndexedHeapStorage(std::initializer_list<T> init, Compare c)
+    : IndexedHeapStorage(init.begin(), init.end(), c) {}
+
+template <typename T, typename Compare>
+auto IndexedHeapStorage<T, Compare>::push(const T& x) -> Handle {
+  return insert(T(x));
+}
+
+template <typename T, typename Compare>
+auto IndexedHeapStorage<T, Compare>::push(T&& x) -> Handle {
+  return insert(std::move(x));
+}
+
+template <typename T, typename Compare>
+template <typename... Args>
+auto IndexedHeapStorage<T, Compare>::emplace(Args&&... args) -> Handle {
+  return insert(T(std::forward<Args>(args)...));
+}
+
+template <typename T, typename Compare>
+void IndexedHeapStorage<T, Compare>::pop() {
+  if (a_.empty()) throw std::out_of_range("pop on empty");
+  removeAt(0);
+}
+
+template <typename T, typename Compare>
+const T& IndexedHeapStorage<T, Compare>::top() const {
+  if (a_.empty()) throw std::out_of_range("top on empty");
+  return a_.front();
+}
+
+template <typename T, typename Compare>
+T IndexedHeapStorage<T, Compare>::take_top() {
+  if (a_.empty()) throw std::out_of_range("take_top on empty");
+  T x = std::move(a_.front());
+  removeAt(0);
+  return x;
+}
+
+template <typename T, typename Compare>
+auto IndexedHeapStorage<T, Compare>::top_handle() const -> Handle {
+  if (a_.empty()) throw std::out_of_range("top on empty");
+  return Handle{static_cast<std::uint32_t>(slot_.front()), gen_[slot_.front()]};
+}
+
+template <typename T, typename Compare>
+void IndexedHeapStorage<T, Compare>::update(Handle h, const T& x) {
+  update(h, T(x));
+}
+
+template <typename T, typename Compare>
+void IndexedHeapStorage<T, Compare>::update(Handle h, T&& x) {
+  std::size_t i = checked(h);
+  bool up = cmp_(a_[i], x);
+  a_[i] = std::move(x);
+  if (up) siftUp(i);
+  else siftDown(i);
+}
+
+template <typename T, typename Compare>
+void IndexedHeapStorage<T, Compare>::erase(Handle h) {
+  removeAt(checked(h));
+}
+
+template <typename T, typename Compare>
+void IndexedHeapStorage<T, Compare>::reserve(std::size_t n) {
+  a_.reserve(n);
+  slot_.reserve(n);
+  pos_.reserve(n);
+  gen_.reserve(n);
+}
+
+} // namespace ds
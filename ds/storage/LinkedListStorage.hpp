@@ -1,25 +1,43 @@
 #pragma once
 #include <cstddef>
+#include <iterator>
+#include <memory>
 #include <stdexcept>
+#include <utility>
+#include "PoolAllocator.hpp"
+#include "../profiling/AllocCounter.hpp"
 
 namespace ds {
 
-template <typename T>
+template <typename T, typename Alloc = std::allocator<T>>
 class LinkedListStorage {
   struct Node {
     T val;
     Node* prev{nullptr};
     Node* next{nullptr};
-    explicit Node(const T& v) : val(v) {}
+    template <typename... Args>
+    explicit Node(std::in_place_t, Args&&... args) : val(std::forward<Args>(args)...) {}
   };
+  using NodeAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+  using NodeTraits = std::allocator_traits<NodeAlloc>;
+
   Node* head_{nullptr};
   Node* tail_{nullptr};
   std::size_t n_{0};
+  [[no_unique_address]] NodeAlloc alloc_;
+
+  template <typename... Args>
+  Node* makeNode(Args&&... args);
+  void freeNode(Node* nd) noexcept;
+  template <typename Compare>
+  static Node* mergeRuns(Node* a, Node* b, Compare& cmp);
 
 public:
   using value_type = T;
+  using allocator_type = Alloc;
 
   LinkedListStorage() = default;
+  explicit LinkedListStorage(const Alloc& a) : alloc_(a) {}
   ~LinkedListStorage();
   
   // Rule of 5: Enable Copy and Move
@@ -28,6 +46,8 @@ public:
   LinkedListStorage& operator=(const LinkedListStorage& other);
   LinkedListStorage& operator=(LinkedListStorage&& other) noexcept;
 
+  allocator_type get_allocator() const { return allocator_type(alloc_); }
+
   // Iterator Support
   class Iterator {
       Node* curr_;
@@ -63,15 +83,36 @@ public:
 
   void clear();
   void push_front(const T& x);
+  void push_front(T&& x);
   void push_back(const T& x);
+  void push_back(T&& x);
+  template <typename... Args> T& emplace_front(Args&&... args);
+  template <typename... Args> T& emplace_back(Args&&... args);
   void pop_front();
   void pop_back();
   const T& front() const;
   const T& back() const;
+  // Pop that moves the element out instead of leaving a copy to the caller.
+  T take_front();
+  T take_back();
   std::size_t size() const;
   bool empty() const;
+
+  // Node-level operations: relink existing nodes, no element copies
+  template <typename Pred> std::size_t remove_if(Pred pred);
+  void splice_back(LinkedListStorage&& other);
+  void reverse() noexcept;
+  template <typename Compare> void merge(LinkedListStorage&& other, Compare cmp);
+  template <typename Compare> void sort(Compare cmp);
 };
 
+/**
+ * LinkedListStorage whose nodes are carved from a per-list slab arena.
+ * Node allocation is a free-list pop or pointer bump; clear() drops whole blocks.
+ */
+template <typename T>
+using PooledLinkedListStorage = LinkedListStorage<T, PoolAllocator<T>>;
+
 } // namespace ds
 
 #include "LinkedListStorage.tpp"
@@ -1,19 +1,21 @@
 namespace ds {
 
-template <typename T>
-LinkedListStorage<T>::~LinkedListStorage() { clear(); }
+template <typename T, typename Alloc>
+LinkedListStorage<T, Alloc>::~LinkedListStorage() { clear(); }
 
 // Copy Constructor
-template <typename T>
-LinkedListStorage<T>::LinkedListStorage(const LinkedListStorage& other) {
+template <typename T, typename Alloc>
+LinkedListStorage<T, Alloc>::LinkedListStorage(const LinkedListStorage& other)
+    : alloc_(NodeTraits::select_on_container_copy_construction(other.alloc_)) {
     for (const auto& item : other) {
         push_back(item);
     }
 }
 
 // Move Constructor
-template <typename T>
-LinkedListStorage<T>::LinkedListStorage(LinkedListStorage&& other) noexcept {
+template <typename T, typename Alloc>
+LinkedListStorage<T, Alloc>::LinkedListStorage(LinkedListStorage&& other) noexcept
+    : alloc_(std::move(other.alloc_)) {
     head_ = other.head_;
     tail_ = other.tail_;
     n_ = other.n_;
@@ -22,8 +24,8 @@ LinkedListStorage<T>::LinkedListStorage(LinkedListStorage&& other) noexcept {
 }
 
 // Copy Assignment
-template <typename T>
-LinkedListStorage<T>& LinkedListStorage<T>::operator=(const LinkedListStorage& other) {
+template <typename T, typename Alloc>
+LinkedListStorage<T, Alloc>& LinkedListStorage<T, Alloc>::operator=(const LinkedListStorage& other) {
     if (this != &other) {
         clear();
         for (const auto& item : other) {
@@ -34,10 +36,13 @@ LinkedListStorage<T>& LinkedListStorage<T>::operator=(const LinkedListStorage& o
 }
 
 // Move Assignment
-template <typename T>
-LinkedListStorage<T>& LinkedListStorage<T>::operator=(LinkedListStorage&& other) noexcept {
+template <typename T, typename Alloc>
+LinkedListStorage<T, Alloc>& LinkedListStorage<T, Alloc>::operator=(LinkedListStorage&& other) noexcept {
+    static_assert(NodeTraits::propagate_on_container_move_assignment::value,
+                  "LinkedListStorage requires an allocator that propagates on move assignment");
     if (this != &other) {
         clear();
+        alloc_ = std::move(other.alloc_);
         head_ = other.head_;
         tail_ = other.tail_;
         n_ = other.n_;
@@ -47,61 +52,245 @@ LinkedListStorage<T>& LinkedListStorage<T>::operator=(LinkedListStorage&& other)
     return *this;
 }
 
-template <typename T>
-void LinkedListStorage<T>::clear() {
+template <typename T, typename Alloc>
+template <typename... Args>
+auto LinkedListStorage<T, Alloc>::makeNode(Args&&... args) -> Node* {
+  Node* nd = NodeTraits::allocate(alloc_, 1);
+  try {
+    NodeTraits::construct(alloc_, nd, std::in_place, std::forward<Args>(args)...);
+  } catch (...) {
+    NodeTraits::deallocate(alloc_, nd, 1);
+    throw;
+  }
+  profiling::nodeCreated();
+  return nd;
+}
+
+template <typename T, typename Alloc>
+void LinkedListStorage<T, Alloc>::freeNode(Node* nd) noexcept {
+  NodeTraits::destroy(alloc_, nd);
+  NodeTraits::deallocate(alloc_, nd, 1);
+  profiling::nodesReleased();
+}
+
+template <typename T, typename Alloc>
+void LinkedListStorage<T, Alloc>::clear() {
   Node* p = head_;
-  while (p) { Node* nx = p->next; delete p; p = nx; }
+  if constexpr (BulkReleasable<NodeAlloc>) {
+    // Sole owner of the arena: destroy values, then drop the blocks wholesale.
+    if (alloc_.unique()) {
+      if constexpr (!std::is_trivially_destructible_v<T>) {
+        while (p) { Node* nx = p->next; NodeTraits::destroy(alloc_, p); p = nx; }
+      }
+      alloc_.release();
+      profiling::nodesReleased(n_);
+      head_ = tail_ = nullptr; n_ = 0;
+      return;
+    }
+  }
+  while (p) { Node* nx = p->next; freeNode(p); p = nx; }
   head_ = tail_ = nullptr; n_ = 0;
 }
 
-template <typename T>
-void LinkedListStorage<T>::push_front(const T& x) {
-  Node* nd = new Node(x);
+template <typename T, typename Alloc>
+template <typename... Args>
+T& LinkedListStorage<T, Alloc>::emplace_front(Args&&... args) {
+  Node* nd = makeNode(std::forward<Args>(args)...);
   nd->next = head_;
   if (head_) head_->prev = nd; else tail_ = nd;
   head_ = nd; ++n_;
+  return nd->val;
 }
 
-template <typename T>
-void LinkedListStorage<T>::push_back(const T& x) {
-  Node* nd = new Node(x);
+template <typename T, typename Alloc>
+template <typename... Args>
+T& LinkedListStorage<T, Alloc>::emplace_back(Args&&... args) {
+  Node* nd = makeNode(std::forward<Args>(args)...);
   nd->prev = tail_;
   if (tail_) tail_->next = nd; else head_ = nd;
   tail_ = nd; ++n_;
+  return nd->val;
 }
 
-template <typename T>
-void LinkedListStorage<T>::pop_front() {
+template <typename T, typename Alloc>
+void LinkedListStorage<T, Alloc>::push_front(const T& x) { emplace_front(x); }
+
+template <typename T, typename Alloc>
+void LinkedListStorage<T, Alloc>::push_front(T&& x) { emplace_front(std::move(x)); }
+
+template <typename T, typename Alloc>
+void LinkedListStorage<T, Alloc>::push_back(const T& x) { emplace_back(x); }
+
+template <typename T, typename Alloc>
+void LinkedListStorage<T, Alloc>::push_back(T&& x) { emplace_back(std::move(x)); }
+
+template <typename T, typename Alloc>
+void LinkedListStorage<T, Alloc>::pop_front() {
   if (!n_) throw std::out_of_range("pop_front on empty");
   Node* old = head_; head_ = head_->next;
   if (head_) head_->prev = nullptr; else tail_ = nullptr;
-  delete old; --n_;
+  freeNode(old); --n_;
 }
 
-template <typename T>
-void LinkedListStorage<T>::pop_back() {
+template <typename T, typename Alloc>
+void LinkedListStorage<T, Alloc>::pop_back() {
   if (!n_) throw std::out_of_range("pop_back on empty");
   Node* old = tail_; tail_ = tail_->prev;
   if (tail_) tail_->next = nullptr; else head_ = nullptr;
-  delete old; --n_;
+  freeNode(old); --n_;
 }
 
-template <typename T>
-const T& LinkedListStorage<T>::front() const {
+template <typename T, typename Alloc>
+const T& LinkedListStorage<T, Alloc>::front() const {
   if (!n_) throw std::out_of_range("front on empty");
   return head_->val;
 }
 
-template <typename T>
-const T& LinkedListStorage<T>::back() const {
+template <typename T, typename Alloc>
+const T& LinkedListStorage<T, Alloc>::back() const {
   if (!n_) throw std::out_of_range("back on empty");
   return tail_->val;
 }
 
-template <typename T>
-std::size_t LinkedListStorage<T>::size() const { return n_; }
+template <typename T, typename Alloc>
+T LinkedListStorage<T, Alloc>::take_front() {
+  if (!n_) throw std::out_of_range("take_front on empty");
+  T x = std::move(head_->val);
+  pop_front();
+  return x;
+}
+
+template <typename T, typename Alloc>
+T LinkedListStorage<T, Alloc>::take_back() {
+  if (!n_) throw std::out_of_range("take_back on empty");
+  T x = std::move(tail_->val);
+  pop_back();
+  return x;
+}
 
-template <typename T>
-bool LinkedListStorage<T>::empty() const { return n_ == 0; }
+template <typename T, typename Alloc>
+std::size_t LinkedListStorage<T, Alloc>::size() const { return n_; }
+
+template <typename T, typename Alloc>
+bool LinkedListStorage<T, Alloc>::empty() const { return n_ == 0; }
+
+// Unlinks and frees every node whose value satisfies pred; survivors keep their nodes.
+template <typename T, typename Alloc>
+template <typename Pred>
+std::size_t LinkedListStorage<T, Alloc>::remove_if(Pred pred) {
+  std::size_t removed = 0;
+  Node* p = head_;
+  while (p) {
+    Node* nx = p->next;
+    if (pred(p->val)) {
+      if (p->prev) p->prev->next = nx; else head_ = nx;
+      if (nx) nx->prev = p->prev; else tail_ = p->prev;
+      freeNode(p);
+      ++removed;
+    }
+    p = nx;
+  }
+  n_ -= removed;
+  return removed;
+}
+
+// Appends other's nodes in O(1) when both lists share an allocator; otherwise moves elements.
+template <typename T, typename Alloc>
+void LinkedListStorage<T, Alloc>::splice_back(LinkedListStorage&& other) {
+  if (this == &other || other.empty()) return;
+  if (alloc_ != other.alloc_) {
+    for (auto& item : other) emplace_back(std::move(item));
+    other.clear();
+    return;
+  }
+  if (tail_) { tail_->next = other.head_; other.head_->prev = tail_; } else head_ = other.head_;
+  tail_ = other.tail_;
+  n_ += other.n_;
+  other.head_ = other.tail_ = nullptr;
+  other.n_ = 0;
+}
+
+// Reverses the list by swapping each node's links.
+template <typename T, typename Alloc>
+void LinkedListStorage<T, Alloc>::reverse() noexcept {
+  for (Node* p = head_; p; p = p->prev) std::swap(p->prev, p->next);
+  std::swap(head_, tail_);
+}
+
+// Merges sorted other into this sorted list by relinking; on ties this list's nodes come first.
+template <typename T, typename Alloc>
+template <typename Compare>
+void LinkedListStorage<T, Alloc>::merge(LinkedListStorage&& other, Compare cmp) {
+  if (this == &other || other.empty()) return;
+  if (alloc_ != other.alloc_) {
+    LinkedListStorage local(get_allocator());
+    for (auto& item : other) local.emplace_back(std::move(item));
+    other.clear();
+    merge(std::move(local), cmp);
+    return;
+  }
+  Node* a = head_;
+  Node* b = other.head_;
+  Node* last = nullptr;
+  while (a && b) {
+    Node* e;
+    if (cmp(b->val, a->val)) { e = b; b = b->next; } else { e = a; a = a->next; }
+    e->prev = last;
+    if (last) last->next = e; else head_ = e;
+    last = e;
+  }
+  Node* rest = a ? a : b;
+  rest->prev = last;
+  if (last) last->next = rest; else head_ = rest;
+  if (!a) tail_ = other.tail_;
+  n_ += other.n_;
+  other.head_ = other.tail_ = nullptr;
+  other.n_ = 0;
+}
+
+// Stable merge of two null-terminated runs linked through next; a's nodes win ties.
+template <typename T, typename Alloc>
+template <typename Compare>
+auto LinkedListStorage<T, Alloc>::mergeRuns(Node* a, Node* b, Compare& cmp) -> Node* {
+  Node* head = nullptr;
+  Node** link = &head;
+  while (a && b) {
+    if (cmp(b->val, a->val)) { *link = b; b = b->next; } else { *link = a; a = a->next; }
+    link = &(*link)->next;
+  }
+  *link = a ? a : b;
+  return head;
+}
+
+// Stable bottom-up merge sort that relinks the existing nodes: no element copies,
+// no allocation, no recursion. Nodes are fed into a binary counter of sorted runs
+// (bin i holds 2^i nodes), so merges happen while the runs are still cache-hot;
+// the bins are a fixed array, O(1) extra memory. Back links are rebuilt at the end.
+template <typename T, typename Alloc>
+template <typename Compare>
+void LinkedListStorage<T, Alloc>::sort(Compare cmp) {
+  if (n_ < 2) return;
+  Node* bins[64] = {};
+  Node* p = head_;
+  while (p) {
+    Node* carry = p;
+    p = p->next;
+    carry->next = nullptr;
+    std::size_t i = 0;
+    for (; bins[i]; ++i) {
+      carry = mergeRuns(bins[i], carry, cmp);   // bins hold earlier nodes: they go left
+      bins[i] = nullptr;
+    }
+    bins[i] = carry;
+  }
+  Node* list = nullptr;
+  for (Node* bin : bins) {
+    if (bin) list = mergeRuns(bin, list, cmp);
+  }
+  Node* prev = nullptr;
+  for (Node* x = list; x; x = x->next) { x->prev = prev; prev = x; }
+  head_ = list;
+  tail_ = prev;
+}
 
 } // namespace ds
@@ -0,0 +1,97 @@
+#pragma once
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace ds {
+
+namespace internal {
+
+// Slab arena: carves small fixed-size slots out of large blocks.
+// Freed slots go onto a per-size-class free list and are reused by the next
+// allocation of that class; release() returns every block at once.
+class SlabArena {
+  static constexpr std::size_t kGranule = alignof(std::max_align_t);
+  static constexpr std::size_t kClasses = 16;            // slots up to 16 * kGranule bytes
+  static constexpr std::size_t kMinBlock = 1024;         // first block, in bytes
+  static constexpr std::size_t kMaxBlock = 256 * 1024;   // blocks double up to this size
+
+  struct FreeSlot { FreeSlot* next; };
+  struct Block { Block* next; };
+
+  FreeSlot* free_[kClasses]{};
+  Block* blocks_{nullptr};
+  char* cur_{nullptr};
+  char* end_{nullptr};
+  std::size_t nextBlock_{kMinBlock};
+
+  void grow(std::size_t atLeast);
+
+public:
+  SlabArena() = default;
+  ~SlabArena();
+  SlabArena(const SlabArena&) = delete;
+  SlabArena& operator=(const SlabArena&) = delete;
+
+  void* allocate(std::size_t bytes, std::size_t align);
+  void deallocate(void* p, std::size_t bytes, std::size_t align) noexcept;
+  void release() noexcept;
+};
+
+} // namespace internal
+
+/**
+ * PoolAllocator: Standard allocator backed by a shared SlabArena.
+ * Copies (and rebinds) share one arena; a container copy gets a fresh one.
+ * Meant for node-based containers: single-object requests come from the slabs,
+ * anything larger falls through to operator new.
+ */
+template <typename T>
+class PoolAllocator {
+  std::shared_ptr<internal::SlabArena> arena_;
+
+  template <typename U> friend class PoolAllocator;
+
+public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  PoolAllocator();
+  PoolAllocator(const PoolAllocator& other) noexcept = default;
+  PoolAllocator(PoolAllocator&& other) noexcept = default;
+  PoolAllocator& operator=(const PoolAllocator& other) noexcept = default;
+  PoolAllocator& operator=(PoolAllocator&& other) noexcept = default;
+  template <typename U>
+  PoolAllocator(const PoolAllocator<U>& other) noexcept : arena_(other.arena_) {}
+
+  T* allocate(std::size_t n);
+  void deallocate(T* p, std::size_t n) noexcept;
+
+  PoolAllocator select_on_container_copy_construction() const { return PoolAllocator{}; }
+
+  // Bulk release: only safe when no other allocator shares the arena.
+  bool unique() const noexcept { return arena_ && arena_.use_count() == 1; }
+  void release() noexcept { if (arena_) arena_->release(); }
+
+  template <typename U>
+  bool operator==(const PoolAllocator<U>& other) const noexcept { return arena_ == other.arena_; }
+};
+
+/**
+ * Allocators that can drop every outstanding allocation in one call.
+ * LinkedListStorage uses this to make clear()/destruction O(blocks) instead of O(nodes).
+ */
+template <typename A>
+concept BulkReleasable = requires(A& a, const A& ca) {
+  { ca.unique() } -> std::convertible_to<bool>;
+  a.release();
+};
+
+} // namespace ds
+
+#include "PoolAllocator.tpp"
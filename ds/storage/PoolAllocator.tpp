@@ -0,0 +1,77 @@
+namespace ds {
+
+namespace internal {
+
+inline SlabArena::~SlabArena() { release(); }
+
+inline void SlabArena::grow(std::size_t atLeast) {
+  std::size_t bytes = nextBlock_;
+  while (bytes < atLeast + sizeof(Block)) bytes *= 2;
+  if (nextBlock_ < kMaxBlock) nextBlock_ *= 2;
+
+  char* raw = static_cast<char*>(::operator new(bytes, std::align_val_t{kGranule}));
+  Block* b = reinterpret_cast<Block*>(raw);
+  b->next = blocks_;
+  blocks_ = b;
+  cur_ = raw + kGranule;   // keep slots granule-aligned past the header
+  end_ = raw + bytes;
+}
+
+inline void* SlabArena::allocate(std::size_t bytes, std::size_t align) {
+  std::size_t cls = (bytes + kGranule - 1) / kGranule;
+  if (cls == 0) cls = 1;
+  if (cls > kClasses || align > kGranule) {
+    return ::operator new(bytes, std::align_val_t{align});
+  }
+  if (FreeSlot* s = free_[cls - 1]) {
+    free_[cls - 1] = s->next;
+    return s;
+  }
+  std::size_t slot = cls * kGranule;
+  if (static_cast<std::size_t>(end_ - cur_) < slot) grow(slot);
+  void* p = cur_;
+  cur_ += slot;
+  return p;
+}
+
+inline void SlabArena::deallocate(void* p, std::size_t bytes, std::size_t align) noexcept {
+  std::size_t cls = (bytes + kGranule - 1) / kGranule;
+  if (cls == 0) cls = 1;
+  if (cls > kClasses || align > kGranule) {
+    ::operator delete(p, std::align_val_t{align});
+    return;
+  }
+  FreeSlot* s = static_cast<FreeSlot*>(p);
+  s->next = free_[cls - 1];
+  free_[cls - 1] = s;
+}
+
+inline void SlabArena::release() noexcept {
+  while (blocks_) {
+    Block* nx = blocks_->next;
+    ::operator delete(static_cast<void*>(blocks_), std::align_val_t{kGranule});
+    blocks_ = nx;
+  }
+  for (auto& f : free_) f = nullptr;
+  cur_ = end_ = nullptr;
+  nextBlock_ = kMinBlock;
+}
+
+} // namespace internal
+
+template <typename T>
+PoolAllocator<T>::PoolAllocator() : arena_(std::make_shared<internal::SlabArena>()) {}
+
+template <typename T>
+T* PoolAllocator<T>::allocate(std::size_t n) {
+  // A moved-from allocator may be reused; give it a fresh arena.
+  if (!arena_) arena_ = std::make_shared<internal::SlabArena>();
+  return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+}
+
+template <typename T>
+void PoolAllocator<T>::deallocate(T* p, std::size_t n) noexcept {
+  arena_->deallocate(p, n * sizeof(T), alignof(T));
+}
+
+} // namespace ds
@@ -0,0 +1,108 @@
+#pragma once
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ds {
+
+/**
+ * RingBufferStorage: Contiguous circular buffer with power-of-two capacity.
+ * O(1) push/pop at both ends, amortized growth by doubling, no per-element allocation.
+ * Satisfies SequenceStorage, so it drops into Stack, Queue and Deque.
+ */
+template <typename T>
+class RingBufferStorage {
+  using Traits = std::allocator_traits<std::allocator<T>>;
+
+  T* buf_{nullptr};
+  std::size_t cap_{0};    // always 0 or a power of two
+  std::size_t head_{0};   // physical index of the front element
+  std::size_t n_{0};
+  [[no_unique_address]] std::allocator<T> alloc_;
+
+  std::size_t mask() const { return cap_ - 1; }
+  T* slot(std::size_t i) const { return buf_ + ((head_ + i) & mask()); }
+  void regrow(std::size_t newCap);
+  void grow() { regrow(cap_ ? cap_ * 2 : 8); }
+
+public:
+  using value_type = T;
+
+  RingBufferStorage() = default;
+  ~RingBufferStorage();
+
+  // Rule of 5: Enable Copy and Move
+  RingBufferStorage(const RingBufferStorage& other);
+  RingBufferStorage(RingBufferStorage&& other) noexcept;
+  RingBufferStorage& operator=(const RingBufferStorage& other);
+  RingBufferStorage& operator=(RingBufferStorage&& other) noexcept;
+
+  // Iterator Support: random access in logical order (front to back), wrapping over the buffer end
+  class Iterator {
+      const RingBufferStorage* rb_;
+      std::size_t i_;
+  public:
+      using iterator_category = std::random_access_iterator_tag;
+      using value_type = T;
+      using difference_type = std::ptrdiff_t;
+      using pointer = T*;
+      using reference = T&;
+
+      Iterator(const RingBufferStorage* rb = nullptr, std::size_t i = 0) : rb_(rb), i_(i) {}
+
+      T& operator*() const { return *rb_->slot(i_); }
+      T* operator->() const { return rb_->slot(i_); }
+      T& operator[](difference_type d) const { return *rb_->slot(i_ + d); }
+
+      Iterator& operator++() { ++i_; return *this; }
+      Iterator operator++(int) { Iterator tmp = *this; ++i_; return tmp; }
+      Iterator& operator--() { --i_; return *this; }
+      Iterator operator--(int) { Iterator tmp = *this; --i_; return tmp; }
+      Iterator& operator+=(difference_type d) { i_ += d; return *this; }
+      Iterator& operator-=(difference_type d) { i_ -= d; return *this; }
+      Iterator operator+(difference_type d) const { return Iterator(rb_, i_ + d); }
+      Iterator operator-(difference_type d) const { return Iterator(rb_, i_ - d); }
+      friend Iterator operator+(difference_type d, const Iterator& it) { return it + d; }
+      difference_type operator-(const Iterator& other) const {
+          return static_cast<difference_type>(i_) - static_cast<difference_type>(other.i_);
+      }
+
+      bool operator==(const Iterator& other) const { return i_ == other.i_; }
+      bool operator!=(const Iterator& other) const { return i_ != other.i_; }
+      auto operator<=>(const Iterator& other) const { return i_ <=> other.i_; }
+  };
+
+  Iterator begin() const { return Iterator(this, 0); }
+  Iterator end() const { return Iterator(this, n_); }
+
+  void clear();
+  void reserve(std::size_t n);
+  std::size_t capacity() const { return cap_; }
+
+  void push_front(const T& x);
+  void push_front(T&& x);
+  void push_back(const T& x);
+  void push_back(T&& x);
+  template <typename... Args> T& emplace_front(Args&&... args);
+  template <typename... Args> T& emplace_back(Args&&... args);
+  void pop_front();
+  void pop_back();
+  const T& front() const;
+  const T& back() const;
+  // Pop that moves the element out instead of leaving a copy to the caller.
+  T take_front();
+  T take_back();
+  const T& operator[](std::size_t i) const { return *slot(i); }
+  T& operator[](std::size_t i) { return *slot(i); }
+  std::size_t size() const;
+  bool empty() const;
+};
+
+} // namespace ds
+
+#include "RingBufferStorage.tpp"
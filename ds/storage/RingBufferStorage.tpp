@@ -0,0 +1,172 @@
+namespace ds {
+
+template <typename T>
+RingBufferStorage<T>::~RingBufferStorage() {
+  clear();
+  if (buf_) Traits::deallocate(alloc_, buf_, cap_);
+}
+
+// Copy Constructor
+template <typename T>
+RingBufferStorage<T>::RingBufferStorage(const RingBufferStorage& other) {
+  reserve(other.n_);
+  for (const auto& item : other) {
+    push_back(item);
+  }
+}
+
+// Move Constructor
+template <typename T>
+RingBufferStorage<T>::RingBufferStorage(RingBufferStorage&& other) noexcept
+    : buf_(other.buf_), cap_(other.cap_), head_(other.head_), n_(other.n_) {
+  other.buf_ = nullptr;
+  other.cap_ = other.head_ = other.n_ = 0;
+}
+
+// Copy Assignment
+template <typename T>
+RingBufferStorage<T>& RingBufferStorage<T>::operator=(const RingBufferStorage& other) {
+  if (this != &other) {
+    clear();
+    reserve(other.n_);
+    for (const auto& item : other) {
+      push_back(item);
+    }
+  }
+  return *this;
+}
+
+// Move Assignment
+template <typename T>
+RingBufferStorage<T>& RingBufferStorage<T>::operator=(RingBufferStorage&& other) noexcept {
+  if (this != &other) {
+    clear();
+    if (buf_) Traits::deallocate(alloc_, buf_, cap_);
+    buf_ = other.buf_; cap_ = other.cap_; head_ = other.head_; n_ = other.n_;
+    other.buf_ = nullptr;
+    other.cap_ = other.head_ = other.n_ = 0;
+  }
+  return *this;
+}
+
+// Moves the live range into a fresh buffer of newCap slots, front at index 0.
+template <typename T>
+void RingBufferStorage<T>::regrow(std::size_t newCap) {
+  T* nb = Traits::allocate(alloc_, newCap);
+  std::size_t moved = 0;
+  try {
+    for (; moved < n_; ++moved) {
+      Traits::construct(alloc_, nb + moved, std::move_if_noexcept(*slot(moved)));
+    }
+  } catch (...) {
+    for (std::size_t i = 0; i < moved; ++i) Traits::destroy(alloc_, nb + i);
+    Traits::deallocate(alloc_, nb, newCap);
+    throw;
+  }
+  for (std::size_t i = 0; i < n_; ++i) Traits::destroy(alloc_, slot(i));
+  if (buf_) Traits::deallocate(alloc_, buf_, cap_);
+  buf_ = nb; cap_ = newCap; head_ = 0;
+}
+
+template <typename T>
+void RingBufferStorage<T>::reserve(std::size_t n) {
+  if (n <= cap_) return;
+  regrow(std::bit_ceil(n < 8 ? std::size_t{8} : n));
+}
+
+template <typename T>
+void RingBufferStorage<T>::clear() {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    for (std::size_t i = 0; i < n_; ++i) Traits::destroy(alloc_, slot(i));
+  }
+  head_ = 0; n_ = 0;
+}
+
+template <typename T>
+template <typename... Args>
+T& RingBufferStorage<T>::emplace_front(Args&&... args) {
+  if (n_ == cap_) {
+    T tmp(std::forward<Args>(args)...);   // args may alias an element that grow() relocates
+    grow();
+    Traits::construct(alloc_, buf_ + ((head_ - 1) & mask()), std::move(tmp));
+  } else {
+    Traits::construct(alloc_, buf_ + ((head_ - 1) & mask()), std::forward<Args>(args)...);
+  }
+  head_ = (head_ - 1) & mask(); ++n_;
+  return buf_[head_];
+}
+
+template <typename T>
+template <typename... Args>
+T& RingBufferStorage<T>::emplace_back(Args&&... args) {
+  if (n_ == cap_) {
+    T tmp(std::forward<Args>(args)...);   // args may alias an element that grow() relocates
+    grow();
+    Traits::construct(alloc_, slot(n_), std::move(tmp));
+  } else {
+    Traits::construct(alloc_, slot(n_), std::forward<Args>(args)...);
+  }
+  return *slot(n_++);
+}
+
+template <typename T>
+void RingBufferStorage<T>::push_front(const T& x) { emplace_front(x); }
+
+template <typename T>
+void RingBufferStorage<T>::push_front(T&& x) { emplace_front(std::move(x)); }
+
+template <typename T>
+void RingBufferStorage<T>::push_back(const T& x) { emplace_back(x); }
+
+template <typename T>
+void RingBufferStorage<T>::push_back(T&& x) { emplace_back(std::move(x)); }
+
+template <typename T>
+void RingBufferStorage<T>::pop_front() {
+  if (!n_) throw std::out_of_range("pop_front on empty");
+  Traits::destroy(alloc_, buf_ + head_);
+  head_ = (head_ + 1) & mask(); --n_;
+}
+
+template <typename T>
+void RingBufferStorage<T>::pop_back() {
+  if (!n_) throw std::out_of_range("pop_back on empty");
+  Traits::destroy(alloc_, slot(n_ - 1));
+  --n_;
+}
+
+template <typename T>
+const T& RingBufferStorage<T>::front() const {
+  if (!n_) throw std::out_of_range("front on empty");
+  return *slot(0);
+}
+
+template <typename T>
+const T& RingBufferStorage<T>::back() const {
+  if (!n_) throw std::out_of_range("back on empty");
+  return *slot(n_ - 1);
+}
+
+template <typename T>
+T RingBufferStorage<T>::take_front() {
+  if (!n_) throw std::out_of_range("take_front on empty");
+  T x = std::move(*slot(0));
+  pop_front();
+  return x;
+}
+
+template <typename T>
+T RingBufferStorage<T>::take_back() {
+  if (!n_) throw std::out_of_range("take_back on empty");
+  T x = std::move(*slot(n_ - 1));
+  pop_back();
+  return x;
+}
+
+template <typename T>
+std::size_t RingBufferStorage<T>::size() const { return n_; }
+
+template <typename T>
+bool RingBufferStorage<T>::empty() const { return n_ == 0; }
+
+} // namespace ds
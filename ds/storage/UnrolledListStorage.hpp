@@ -0,0 +1,110 @@
+#pragma once
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ds {
+
+/**
+ * UnrolledListStorage: Doubly linked list of fixed-size arrays.
+ * Each block keeps its live elements contiguous in [lo, hi), so push/pop at both ends
+ * stay O(1) while allocation and pointer chasing drop to once per BlockSize elements.
+ * Satisfies SequenceStorage: a drop-in Storage for Stack, Queue and Deque.
+ */
+template <typename T, std::size_t BlockSize = 64>
+class UnrolledListStorage {
+  static_assert(BlockSize >= 2, "UnrolledListStorage needs at least two slots per block");
+
+  struct Block {
+    Block* prev{nullptr};
+    Block* next{nullptr};
+    std::size_t lo{0};
+    std::size_t hi{0};
+    alignas(T) unsigned char raw[BlockSize * sizeof(T)];
+
+    void* slot(std::size_t i) { return raw + i * sizeof(T); }
+    T* at(std::size_t i) { return std::launder(static_cast<T*>(slot(i))); }
+  };
+
+  Block* head_{nullptr};
+  Block* tail_{nullptr};
+  Block* spare_{nullptr};   // one cached empty block, avoids alloc/free ping-pong at a boundary
+  std::size_t n_{0};
+
+  Block* takeBlock();
+  void dropBlock(Block* b);
+
+public:
+  using value_type = T;
+  static constexpr std::size_t block_size = BlockSize;
+
+  UnrolledListStorage() = default;
+  ~UnrolledListStorage();
+
+  // Rule of 5: Enable Copy and Move
+  UnrolledListStorage(const UnrolledListStorage& other);
+  UnrolledListStorage(UnrolledListStorage&& other) noexcept;
+  UnrolledListStorage& operator=(const UnrolledListStorage& other);
+  UnrolledListStorage& operator=(UnrolledListStorage&& other) noexcept;
+
+  // Iterator Support: steps through each block's contiguous slots, then hops to the next block
+  class Iterator {
+      Block* blk_;
+      std::size_t i_;
+  public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = T;
+      using difference_type = std::ptrdiff_t;
+      using pointer = T*;
+      using reference = T&;
+
+      Iterator(Block* b = nullptr, std::size_t i = 0) : blk_(b), i_(i) {}
+
+      T& operator*() const { return *blk_->at(i_); }
+      T* operator->() const { return blk_->at(i_); }
+
+      Iterator& operator++() {
+          if (++i_ == blk_->hi) {
+              blk_ = blk_->next;
+              i_ = blk_ ? blk_->lo : 0;
+          }
+          return *this;
+      }
+
+      Iterator operator++(int) {
+          Iterator tmp = *this;
+          ++(*this);
+          return tmp;
+      }
+
+      bool operator==(const Iterator& other) const { return blk_ == other.blk_ && i_ == other.i_; }
+      bool operator!=(const Iterator& other) const { return !(*this == other); }
+  };
+
+  Iterator begin() const { return head_ ? Iterator(head_, head_->lo) : end(); }
+  Iterator end() const { return Iterator(nullptr, 0); }
+
+  void clear();
+  void push_front(const T& x);
+  void push_front(T&& x);
+  void push_back(const T& x);
+  void push_back(T&& x);
+  template <typename... Args> T& emplace_front(Args&&... args);
+  template <typename... Args> T& emplace_back(Args&&... args);
+  void pop_front();
+  void pop_back();
+  const T& front() const;
+  const T& back() const;
+  // Pop that moves the element out instead of leaving a copy to the caller.
+  T take_front();
+  T take_back();
+  std::size_t size() const;
+  bool empty() const;
+};
+
+} // namespace ds
+
+#include "UnrolledListStorage.tpp"
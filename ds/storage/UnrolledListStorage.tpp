@@ -0,0 +1,195 @@
+namespace ds {
+
+template <typename T, std::size_t BlockSize>
+UnrolledListStorage<T, BlockSize>::~UnrolledListStorage() {
+  clear();
+  delete spare_;
+}
+
+// Copy Constructor
+template <typename T, std::size_t BlockSize>
+UnrolledListStorage<T, BlockSize>::UnrolledListStorage(const UnrolledListStorage& other) {
+  for (const auto& item : other) {
+    push_back(item);
+  }
+}
+
+// Move Constructor
+template <typename T, std::size_t BlockSize>
+UnrolledListStorage<T, BlockSize>::UnrolledListStorage(UnrolledListStorage&& other) noexcept
+    : head_(other.head_), tail_(other.tail_), spare_(other.spare_), n_(other.n_) {
+  other.head_ = other.tail_ = other.spare_ = nullptr;
+  other.n_ = 0;
+}
+
+// Copy Assignment
+template <typename T, std::size_t BlockSize>
+UnrolledListStorage<T, BlockSize>& UnrolledListStorage<T, BlockSize>::operator=(const UnrolledListStorage& other) {
+  if (this != &other) {
+    clear();
+    for (const auto& item : other) {
+      push_back(item);
+    }
+  }
+  return *this;
+}
+
+// Move Assignment
+template <typename T, std::size_t BlockSize>
+UnrolledListStorage<T, BlockSize>& UnrolledListStorage<T, BlockSize>::operator=(UnrolledListStorage&& other) noexcept {
+  if (this != &other) {
+    clear();
+    delete spare_;
+    head_ = other.head_; tail_ = other.tail_; spare_ = other.spare_; n_ = other.n_;
+    other.head_ = other.tail_ = other.spare_ = nullptr;
+    other.n_ = 0;
+  }
+  return *this;
+}
+
+template <typename T, std::size_t BlockSize>
+auto UnrolledListStorage<T, BlockSize>::takeBlock() -> Block* {
+  Block* b = spare_ ? spare_ : new Block;
+  spare_ = nullptr;
+  b->prev = b->next = nullptr;
+  return b;
+}
+
+template <typename T, std::size_t BlockSize>
+void UnrolledListStorage<T, BlockSize>::dropBlock(Block* b) {
+  if (spare_) delete b; else spare_ = b;
+}
+
+template <typename T, std::size_t BlockSize>
+void UnrolledListStorage<T, BlockSize>::clear() {
+  Block* b = head_;
+  while (b) {
+    Block* nx = b->next;
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      for (std::size_t i = b->lo; i < b->hi; ++i) b->at(i)->~T();
+    }
+    dropBlock(b);
+    b = nx;
+  }
+  head_ = tail_ = nullptr; n_ = 0;
+}
+
+template <typename T, std::size_t BlockSize>
+template <typename... Args>
+T& UnrolledListStorage<T, BlockSize>::emplace_front(Args&&... args) {
+  if (!head_ || head_->lo == 0) {
+    Block* b = takeBlock();
+    b->lo = b->hi = BlockSize;
+    try {
+      ::new (b->slot(BlockSize - 1)) T(std::forward<Args>(args)...);
+    } catch (...) {
+      dropBlock(b);
+      throw;
+    }
+    b->lo = BlockSize - 1;
+    b->next = head_;
+    if (head_) head_->prev = b; else tail_ = b;
+    head_ = b;
+  } else {
+    ::new (head_->slot(head_->lo - 1)) T(std::forward<Args>(args)...);
+    --head_->lo;
+  }
+  ++n_;
+  return *head_->at(head_->lo);
+}
+
+template <typename T, std::size_t BlockSize>
+template <typename... Args>
+T& UnrolledListStorage<T, BlockSize>::emplace_back(Args&&... args) {
+  if (!tail_ || tail_->hi == BlockSize) {
+    Block* b = takeBlock();
+    b->lo = b->hi = 0;
+    try {
+      ::new (b->slot(0)) T(std::forward<Args>(args)...);
+    } catch (...) {
+      dropBlock(b);
+      throw;
+    }
+    b->hi = 1;
+    b->prev = tail_;
+    if (tail_) tail_->next = b; else head_ = b;
+    tail_ = b;
+  } else {
+    ::new (tail_->slot(tail_->hi)) T(std::forward<Args>(args)...);
+    ++tail_->hi;
+  }
+  ++n_;
+  return *tail_->at(tail_->hi - 1);
+}
+
+template <typename T, std::size_t BlockSize>
+void UnrolledListStorage<T, BlockSize>::push_front(const T& x) { emplace_front(x); }
+
+template <typename T, std::size_t BlockSize>
+void UnrolledListStorage<T, BlockSize>::push_front(T&& x) { emplace_front(std::move(x)); }
+
+template <typename T, std::size_t BlockSize>
+void UnrolledListStorage<T, BlockSize>::push_back(const T& x) { emplace_back(x); }
+
+template <typename T, std::size_t BlockSize>
+void UnrolledListStorage<T, BlockSize>::push_back(T&& x) { emplace_back(std::move(x)); }
+
+template <typename T, std::size_t BlockSize>
+void UnrolledListStorage<T, BlockSize>::pop_front() {
+  if (!n_) throw std::out_of_range("pop_front on empty");
+  head_->at(head_->lo)->~T();
+  if (++head_->lo == head_->hi) {
+    Block* old = head_; head_ = head_->next;
+    if (head_) head_->prev = nullptr; else tail_ = nullptr;
+    dropBlock(old);
+  }
+  --n_;
+}
+
+template <typename T, std::size_t BlockSize>
+void UnrolledListStorage<T, BlockSize>::pop_back() {
+  if (!n_) throw std::out_of_range("pop_back on empty");
+  tail_->at(tail_->hi - 1)->~T();
+  if (--tail_->hi == tail_->lo) {
+    Block* old = tail_; tail_ = tail_->prev;
+    if (tail_) tail_->next = nullptr; else head_ = nullptr;
+    dropBlock(old);
+  }
+  --n_;
+}
+
+template <typename T, std::size_t BlockSize>
+const T& UnrolledListStorage<T, BlockSize>::front() const {
+  if (!n_) throw std::out_of_range("front on empty");
+  return *head_->at(head_->lo);
+}
+
+template <typename T, std::size_t BlockSize>
+const T& UnrolledListStorage<T, BlockSize>::back() const {
+  if (!n_) throw std::out_of_range("back on empty");
+  return *tail_->at(tail_->hi - 1);
+}
+
+template <typename T, std::size_t BlockSize>
+T UnrolledListStorage<T, BlockSize>::take_front() {
+  if (!n_) throw std::out_of_range("take_front on empty");
+  T x = std::move(*head_->at(head_->lo));
+  pop_front();
+  return x;
+}
+
+template <typename T, std::size_t BlockSize>
+T UnrolledListStorage<T, BlockSize>::take_back() {
+  if (!n_) throw std::out_of_range("take_back on empty");
+  T x = std::move(*tail_->at(tail_->hi - 1));
+  pop_back();
+  return x;
+}
+
+template <typename T, std::size_t BlockSize>
+std::size_t UnrolledListStorage<T, BlockSize>::size() const { return n_; }
+
+template <typename T, std::size_t BlockSize>
+bool UnrolledListStorage<T, BlockSize>::empty() const { return n_ == 0; }
+
+} // namespace ds
@@ -1,7 +1,12 @@
 #pragma once
 #include <vector>
 #include <algorithm>
+#include <initializer_list>
+#include <iterator>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "../concepts.hpp"
 
 namespace ds {
 
@@ -16,10 +21,31 @@ public:
 
   VectorHeapStorage();
   explicit VectorHeapStorage(Compare c);
-  
+
+  // Bulk construction: copies the range, then heapifies once in O(N).
+  template <typename It> VectorHeapStorage(It first, It last, Compare c = Compare{});
+  VectorHeapStorage(std::initializer_list<T> init, Compare c = Compare{});
+  template <typename Range>
+  requires Iterable<Range> && (!std::is_same_v<std::remove_cvref_t<Range>, VectorHeapStorage>)
+  explicit VectorHeapStorage(const Range& r, Compare c = Compare{});
+
   void push(const T& x);
+  void push(T&& x);
+  template <typename... Args> void emplace(Args&&... args);
+  // Appends a range with one reservation. Large batches are merged with one O(N) heapify;
+  // batches small next to the heap are sifted up one by one (k log N < N + k).
+  template <typename It> void push_range(It first, It last);
+  template <typename Range> requires Iterable<Range> void push_range(const Range& r);
+  // Moves all of other's elements in (same heuristic as push_range) and leaves other empty.
+  void merge(VectorHeapStorage&& other);
+  void reserve(std::size_t n) { a_.reserve(n); }
+  void clear() { a_.clear(); }
   void pop();
+  // Pops up to n elements into out, best first, moving them out of the heap; returns how many.
+  template <typename OutIt> std::size_t pop_n(OutIt out, std::size_t n);
   const T& top() const;
+  // Pop that moves the top element out instead of leaving a copy to the caller.
+  T take_top();
   std::size_t size() const;
   bool empty() const;
 
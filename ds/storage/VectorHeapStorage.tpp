@@ -6,12 +6,73 @@ VectorHeapStorage<T, Compare>::VectorHeapStorage() : a_(), cmp_(Compare{}) {}
 template <typename T, typename Compare>
 VectorHeapStorage<T, Compare>::VectorHeapStorage(Compare c) : a_(), cmp_(c) {}
 
+template <typename T, typename Compare>
+template <typename It>
+VectorHeapStorage<T, Compare>::VectorHeapStorage(It first, It last, Compare c) : a_(first, last), cmp_(c) {
+  std::make_heap(a_.begin(), a_.end(), cmp_);
+}
+
+template <typename T, typename Compare>
+VectorHeapStorage<T, Compare>::VectorHeapStorage(std::initializer_list<T> init, Compare c)
+    : VectorHeapStorage(init.begin(), init.end(), c) {}
+
+template <typename T, typename Compare>
+template <typename Range>
+requires Iterable<Range> && (!std::is_same_v<std::remove_cvref_t<Range>, VectorHeapStorage<T, Compare>>)
+VectorHeapStorage<T, Compare>::VectorHeapStorage(const Range& r, Compare c)
+    : VectorHeapStorage(r.begin(), r.end(), c) {}
+
 template <typename T, typename Compare>
 void VectorHeapStorage<T, Compare>::push(const T& x) {
   a_.push_back(x);
   std::push_heap(a_.begin(), a_.end(), cmp_);
 }
 
+template <typename T, typename Compare>
+void VectorHeapStorage<T, Compare>::push(T&& x) {
+  a_.push_back(std::move(x));
+  std::push_heap(a_.begin(), a_.end(), cmp_);
+}
+
+template <typename T, typename Compare>
+template <typename... Args>
+void VectorHeapStorage<T, Compare>::emplace(Args&&... args) {
+  a_.emplace_back(std::forward<Args>(args)...);
+  std::push_heap(a_.begin(), a_.end(), cmp_);
+}
+
+template <typename T, typename Compare>
+template <typename It>
+void VectorHeapStorage<T, Compare>::push_range(It first, It last) {
+  std::size_t old = a_.size();
+  if constexpr (std::forward_iterator<It>) {
+    a_.reserve(old + static_cast<std::size_t>(std::distance(first, last)));
+  }
+  a_.insert(a_.end(), first, last);
+  std::size_t added = a_.size() - old;
+  std::size_t logN = 1;
+  while ((std::size_t{1} << logN) < a_.size()) ++logN;
+  if (added * logN < a_.size()) {
+    for (std::size_t i = old + 1; i <= a_.size(); ++i) std::push_heap(a_.begin(), a_.begin() + i, cmp_);
+  } else {
+    std::make_heap(a_.begin(), a_.end(), cmp_);
+  }
+}
+
+template <typename T, typename Compare>
+template <typename Range>
+requires Iterable<Range>
+void VectorHeapStorage<T, Compare>::push_range(const Range& r) {
+  push_range(r.begin(), r.end());
+}
+
+template <typename T, typename Compare>
+void VectorHeapStorage<T, Compare>::merge(VectorHeapStorage&& other) {
+  if (&other == this) return;
+  push_range(std::make_move_iterator(other.a_.begin()), std::make_move_iterator(other.a_.end()));
+  other.a_.clear();
+}
+
 template <typename T, typename Compare>
 void VectorHeapStorage<T, Compare>::pop() {
   if (a_.empty()) throw std::out_of_range("pop on empty");
@@ -19,12 +80,33 @@ void VectorHeapStorage<T, Compare>::pop() {
   a_.pop_back();
 }
 
+template <typename T, typename Compare>
+template <typename OutIt>
+std::size_t VectorHeapStorage<T, Compare>::pop_n(OutIt out, std::size_t n) {
+  std::size_t k = 0;
+  for (; k < n && !a_.empty(); ++k, ++out) {
+    std::pop_heap(a_.begin(), a_.end(), cmp_);
+    *out = std::move(a_.back());
+    a_.pop_back();
+  }
+  return k;
+}
+
 template <typename T, typename Compare>
 const T& VectorHeapStorage<T, Compare>::top() const {
   if (a_.empty()) throw std::out_of_range("top on empty");
   return a_.front();
 }
 
+template <typename T, typename Compare>
+T VectorHeapStorage<T, Compare>::take_top() {
+  if (a_.empty()) throw std::out_of_range("take_top on empty");
+  std::pop_heap(a_.begin(), a_.end(), cmp_);
+  T x = std::move(a_.back());
+  a_.pop_back();
+  return x;
+}
+
 template <typename T, typename Compare>
 std::size_t VectorHeapStorage<T, Compare>::size() const { return a_.size(); }
 
@@ -0,0 +1,8 @@
+#pragma once
+
+// Lazy, allocation-free pipeline views (compose with '|', materialize with a terminal op)
+#include "views/ViewBase.hpp"
+#include "views/Map.hpp"
+#include "views/Filter.hpp"
+#include "views/FlatMap.hpp"
+#include "views/Collect.hpp"
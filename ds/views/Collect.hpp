@@ -0,0 +1,20 @@
+#pragma once
+#include "ViewBase.hpp"
+#include "../algorithms/Collect.hpp"
+
+namespace ds::views {
+
+template <typename Out>
+struct CollectAdaptor : AdaptorBase {
+  template <typename R>
+  Out operator()(R&& r) const { return ds::collect<Out>(r); }
+};
+
+/**
+ * views::collect<Out>(): Terminal step that materializes a pipeline into Out.
+ *   auto v = src | views::filter(p) | views::map(f) | views::collect<std::vector<int>>();
+ */
+template <typename Out>
+CollectAdaptor<Out> collect() { return {}; }
+
+} // namespace ds::views
@@ -0,0 +1,62 @@
+#pragma once
+#include <functional>
+#include "ViewBase.hpp"
+
+namespace ds::views {
+
+/**
+ * FilterView: Lazily skips elements of the base range that fail the predicate.
+ */
+template <typename Base, typename P>
+class FilterView : public ViewBase {
+  Base base_;
+  P p_;
+  using BaseIt = decltype(std::declval<const Base&>().begin());
+
+public:
+  using value_type = range_value_t<Base>;
+
+  class Iterator {
+      BaseIt it_;
+      BaseIt end_;
+      const P* p_;
+
+      void skip() { while (it_ != end_ && !std::invoke(*p_, *it_)) ++it_; }
+  public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = FilterView::value_type;
+      using difference_type = std::ptrdiff_t;
+      using pointer = void;
+      using reference = decltype(*std::declval<BaseIt>());
+
+      Iterator() : it_(), end_(), p_(nullptr) {}
+      Iterator(BaseIt it, BaseIt end, const P* p) : it_(it), end_(end), p_(p) { skip(); }
+
+      reference operator*() const { return *it_; }
+      Iterator& operator++() { ++it_; skip(); return *this; }
+      Iterator operator++(int) { Iterator tmp = *this; ++(*this); return tmp; }
+
+      bool operator==(const Iterator& other) const { return it_ == other.it_; }
+      bool operator!=(const Iterator& other) const { return !(it_ == other.it_); }
+  };
+
+  FilterView(Base base, P p) : base_(std::move(base)), p_(std::move(p)) {}
+
+  Iterator begin() const { return Iterator(base_.begin(), base_.end(), &p_); }
+  Iterator end() const { return Iterator(base_.end(), base_.end(), &p_); }
+};
+
+template <typename P>
+struct FilterAdaptor : AdaptorBase {
+  P p;
+  template <typename R>
+  auto operator()(R&& r) const { return FilterView<all_t<R>, P>(all(std::forward<R>(r)), p); }
+};
+
+/**
+ * views::filter(p): Lazy counterpart of ds::filter.
+ */
+template <typename P>
+FilterAdaptor<std::decay_t<P>> filter(P&& p) { return {{}, std::forward<P>(p)}; }
+
+} // namespace ds::views
@@ -0,0 +1,122 @@
+#pragma once
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <utility>
+#include "ViewBase.hpp"
+
+namespace ds::views {
+
+/**
+ * FlatMapView: Lazily maps each element to an inner range and walks the inner ranges in turn.
+ * Only the inner range of the current element is alive at any time.
+ */
+template <typename Base, typename F>
+class FlatMapView : public ViewBase {
+  Base base_;
+  F f_;
+  using BaseIt = decltype(std::declval<const Base&>().begin());
+  using InnerResult = std::invoke_result_t<const F&, range_value_t<Base>>;
+  using Inner = std::remove_cvref_t<InnerResult>;
+  using InnerIt = decltype(std::declval<const Inner&>().begin());
+  // Inner ranges returned by reference are borrowed; returned by value the iterator holds the
+  // current one in place (no allocation of its own). Copying such an iterator copies that range
+  // and walks to the same index, O(inner size); moving takes the range over and only re-walks
+  // the index (O(1) for random-access ranges). Prefer ++it to it++, which pays for a copy.
+  static constexpr bool kBorrowed = std::is_lvalue_reference_v<InnerResult>;
+  using InnerHolder = std::conditional_t<kBorrowed, const Inner*, std::optional<Inner>>;
+
+public:
+  using value_type = range_value_t<Inner>;
+
+  class Iterator {
+      BaseIt it_;
+      BaseIt end_;
+      const F* f_;
+      InnerHolder inner_{};
+      InnerIt innerIt_{};
+      std::size_t pos_ = 0;   // index of innerIt_ in the current inner range
+
+      void load() {
+          if constexpr (kBorrowed) inner_ = &std::invoke(*f_, *it_);
+          else inner_.emplace(std::invoke(*f_, *it_));
+          innerIt_ = std::as_const(*inner_).begin();
+          pos_ = 0;
+      }
+      // Takes the position of o; an owned inner range is copied or moved over, and the inner
+      // iterator re-seated on it at the same index.
+      template <typename Other>
+      void assignFrom(Other&& o) {
+          it_ = o.it_;
+          end_ = o.end_;
+          f_ = o.f_;
+          pos_ = o.pos_;
+          inner_ = std::forward<Other>(o).inner_;
+          if constexpr (kBorrowed) {
+              innerIt_ = o.innerIt_;
+          } else {
+              innerIt_ = inner_ ? std::next(std::as_const(*inner_).begin(), static_cast<std::ptrdiff_t>(pos_))
+                                : InnerIt{};
+          }
+      }
+      // Advance the outer iterator until an element with a non-empty inner range is found.
+      void settle() {
+          while (it_ != end_) {
+              if (!inner_) load();
+              if (innerIt_ != std::as_const(*inner_).end()) return;
+              inner_ = InnerHolder{};
+              ++it_;
+          }
+      }
+  public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = FlatMapView::value_type;
+      using difference_type = std::ptrdiff_t;
+      using pointer = void;
+      using reference = decltype(*std::declval<InnerIt>());
+
+      Iterator() : it_(), end_(), f_(nullptr) {}
+      Iterator(BaseIt it, BaseIt end, const F* f) : it_(it), end_(end), f_(f) { settle(); }
+      Iterator(const Iterator& o) : f_(nullptr) { assignFrom(o); }
+      Iterator(Iterator&& o) : f_(nullptr) { assignFrom(std::move(o)); }
+      Iterator& operator=(const Iterator& o) {
+          if (this != &o) assignFrom(o);
+          return *this;
+      }
+      Iterator& operator=(Iterator&& o) {
+          if (this != &o) assignFrom(std::move(o));
+          return *this;
+      }
+
+      reference operator*() const { return *innerIt_; }
+      Iterator& operator++() { ++innerIt_; ++pos_; settle(); return *this; }
+      Iterator operator++(int) { Iterator tmp = *this; ++(*this); return tmp; }
+
+      bool operator==(const Iterator& other) const {
+          if (it_ != other.it_) return false;
+          if (it_ == end_) return true;
+          return pos_ == other.pos_;
+      }
+      bool operator!=(const Iterator& other) const { return !(*this == other); }
+  };
+
+  FlatMapView(Base base, F f) : base_(std::move(base)), f_(std::move(f)) {}
+
+  Iterator begin() const { return Iterator(base_.begin(), base_.end(), &f_); }
+  Iterator end() const { return Iterator(base_.end(), base_.end(), &f_); }
+};
+
+template <typename F>
+struct FlatMapAdaptor : AdaptorBase {
+  F f;
+  template <typename R>
+  auto operator()(R&& r) const { return FlatMapView<all_t<R>, F>(all(std::forward<R>(r)), f); }
+};
+
+/**
+ * views::flatMap(f): Lazy counterpart of ds::flatMap. f returns any iterable.
+ */
+template <typename F>
+FlatMapAdaptor<std::decay_t<F>> flatMap(F&& f) { return {{}, std::forward<F>(f)}; }
+
+} // namespace ds::views
@@ -0,0 +1,60 @@
+#pragma once
+#include <functional>
+#include "ViewBase.hpp"
+
+namespace ds::views {
+
+/**
+ * MapView: Lazily applies f to each element of the base range as it is read.
+ */
+template <typename Base, typename F>
+class MapView : public ViewBase {
+  Base base_;
+  F f_;
+  using BaseIt = decltype(std::declval<const Base&>().begin());
+
+public:
+  using value_type = std::remove_cvref_t<std::invoke_result_t<const F&, range_value_t<Base>>>;
+
+  class Iterator {
+      BaseIt it_;
+      const F* f_;
+  public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = MapView::value_type;
+      using difference_type = std::ptrdiff_t;
+      using pointer = void;
+      using reference = value_type;
+
+      Iterator() : it_(), f_(nullptr) {}
+      Iterator(BaseIt it, const F* f) : it_(it), f_(f) {}
+
+      value_type operator*() const { return std::invoke(*f_, *it_); }
+      Iterator& operator++() { ++it_; return *this; }
+      Iterator operator++(int) { Iterator tmp = *this; ++it_; return tmp; }
+
+      bool operator==(const Iterator& other) const { return it_ == other.it_; }
+      bool operator!=(const Iterator& other) const { return !(it_ == other.it_); }
+  };
+
+  MapView(Base base, F f) : base_(std::move(base)), f_(std::move(f)) {}
+
+  Iterator begin() const { return Iterator(base_.begin(), &f_); }
+  Iterator end() const { return Iterator(base_.end(), &f_); }
+  std::size_t size() const requires Sized<Base> { return base_.size(); }
+};
+
+template <typename F>
+struct MapAdaptor : AdaptorBase {
+  F f;
+  template <typename R>
+  auto operator()(R&& r) const { return MapView<all_t<R>, F>(all(std::forward<R>(r)), f); }
+};
+
+/**
+ * views::map(f): Lazy counterpart of ds::map. `src | views::map(f)` allocates nothing.
+ */
+template <typename F>
+MapAdaptor<std::decay_t<F>> map(F&& f) { return {{}, std::forward<F>(f)}; }
+
+} // namespace ds::views
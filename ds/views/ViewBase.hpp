@@ -0,0 +1,81 @@
+#pragma once
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "../concepts.hpp"
+
+namespace ds::views {
+
+// Marker base: anything deriving from it is a cheap-to-copy lazy view.
+struct ViewBase {};
+
+template <typename R>
+concept View = std::is_base_of_v<ViewBase, std::remove_cvref_t<R>>;
+
+template <typename R>
+using range_value_t = std::remove_cvref_t<decltype(*std::declval<const R&>().begin())>;
+
+/**
+ * RefView: Non-owning view over an lvalue container (Stack, Queue, std::vector, ...).
+ * The container must outlive the pipeline.
+ */
+template <typename C>
+class RefView : public ViewBase {
+  const C* c_;
+public:
+  using value_type = range_value_t<C>;
+
+  explicit RefView(const C& c) : c_(&c) {}
+  auto begin() const { return c_->begin(); }
+  auto end() const { return c_->end(); }
+  std::size_t size() const requires Sized<C> { return c_->size(); }
+};
+
+/**
+ * OwningView: Takes ownership of an rvalue container (e.g. the result of ds::filter)
+ * so a pipeline built on a temporary stays valid.
+ */
+template <typename C>
+class OwningView : public ViewBase {
+  C c_;
+public:
+  using value_type = range_value_t<C>;
+
+  explicit OwningView(C&& c) : c_(std::move(c)) {}
+  auto begin() const { return c_.begin(); }
+  auto end() const { return c_.end(); }
+  std::size_t size() const requires Sized<C> { return c_.size(); }
+};
+
+/**
+ * all: Turns any iterable into a view: views pass through, lvalues are referenced,
+ * rvalues are moved into an OwningView.
+ */
+template <typename R>
+requires Iterable<std::remove_cvref_t<R>>
+auto all(R&& r) {
+  if constexpr (View<R>) {
+    return std::remove_cvref_t<R>(std::forward<R>(r));
+  } else if constexpr (std::is_lvalue_reference_v<R>) {
+    return RefView<std::remove_cvref_t<R>>(r);
+  } else {
+    return OwningView<std::remove_cvref_t<R>>(std::move(r));
+  }
+}
+
+template <typename R>
+using all_t = decltype(all(std::declval<R>()));
+
+// Adaptors (views::map(f), views::filter(p), ...) are applied with operator|.
+struct AdaptorBase {};
+
+template <typename A>
+concept Adaptor = std::is_base_of_v<AdaptorBase, std::remove_cvref_t<A>>;
+
+template <typename R, typename A>
+requires Iterable<std::remove_cvref_t<R>> && Adaptor<A>
+auto operator|(R&& r, A&& a) {
+  return std::forward<A>(a)(std::forward<R>(r));
+}
+
+} // namespace ds::views
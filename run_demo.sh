@@ -1,6 +1,6 @@
 #!/bin/bash
 echo "Building CLI Pipeline..."
-g++ -std=c++20 -Wall -I. -o cli_pipeline cli_pipeline.cpp
+g++ -std=c++20 -Wall -pthread -I. -o cli_pipeline cli_pipeline.cpp
 
 echo ""
 echo "========================================"
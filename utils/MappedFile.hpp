@@ -0,0 +1,116 @@
+#pragma once
+#include <cstddef>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define UTILS_HAS_MMAP 1
+#else
+#define UTILS_HAS_MMAP 0
+#endif
+
+namespace utils {
+
+/**
+ * MappedFile: Read-only view of a whole file that owns its backing memory.
+ * Regular files are memory-mapped (no copy into user space); anything that cannot be
+ * mapped (pipes, special files, non-POSIX builds) is read into an owned buffer instead.
+ * Move-only: string_views into text() stay valid for the lifetime of the owning handle,
+ * including after the handle itself is moved.
+ */
+class MappedFile {
+    const char* data_{nullptr};
+    std::size_t size_{0};
+    bool mapped_{false};
+    std::vector<char> buffer_;   // fallback storage; moving a vector keeps its heap block
+    bool ok_{false};
+
+    void unmap() {
+#if UTILS_HAS_MMAP
+        if (mapped_) munmap(const_cast<char*>(data_), size_);
+#endif
+        data_ = nullptr;
+        size_ = 0;
+        mapped_ = false;
+    }
+
+    bool readFallback(const std::string& filepath) {
+        std::ifstream file(filepath, std::ios::binary);
+        if (!file.is_open()) return false;
+        buffer_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+        return true;
+    }
+
+public:
+    MappedFile() = default;
+
+    explicit MappedFile(const std::string& filepath) {
+#if UTILS_HAS_MMAP
+        int fd = ::open(filepath.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        struct stat st{};
+        if (::fstat(fd, &st) == 0 && S_ISREG(st.st_mode)) {
+            ok_ = true;
+            if (st.st_size > 0) {
+                void* p = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                if (p != MAP_FAILED) {
+                    data_ = static_cast<const char*>(p);
+                    size_ = static_cast<std::size_t>(st.st_size);
+                    mapped_ = true;
+                    ::madvise(p, size_, MADV_SEQUENTIAL);
+                } else {
+                    ok_ = readFallback(filepath);
+                }
+            }
+        } else {
+            ok_ = readFallback(filepath);
+        }
+        ::close(fd);
+#else
+        ok_ = readFallback(filepath);
+#endif
+    }
+
+    ~MappedFile() { unmap(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept
+        : data_(other.data_), size_(other.size_), mapped_(other.mapped_),
+          buffer_(std::move(other.buffer_)), ok_(other.ok_) {
+        other.data_ = nullptr;
+        other.size_ = 0;
+        other.mapped_ = other.ok_ = false;
+    }
+
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            data_ = other.data_; size_ = other.size_; mapped_ = other.mapped_; ok_ = other.ok_;
+            buffer_ = std::move(other.buffer_);
+            other.data_ = nullptr;
+            other.size_ = 0;
+            other.mapped_ = other.ok_ = false;
+        }
+        return *this;
+    }
+
+    // False when the file could not be opened.
+    bool is_open() const { return ok_; }
+    bool is_mapped() const { return mapped_; }
+    std::string_view text() const { return {data_, size_}; }
+    std::size_t size() const { return size_; }
+};
+
+} // namespace utils
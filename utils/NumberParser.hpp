@@ -0,0 +1,77 @@
+#pragma once
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+namespace utils {
+
+namespace internal {
+    // True when all 8 bytes at p are ASCII digits (SWAR: one 64-bit test instead of 8 compares).
+    inline bool isEightDigits(const char* p) {
+        std::uint64_t v;
+        std::memcpy(&v, p, 8);
+        return ((v & 0xF0F0F0F0F0F0F0F0) == 0x3030303030303030) &&
+               (((v + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) == 0x3030303030303030);
+    }
+
+    // Value of 8 ASCII digits at p (little-endian loads): pairs, then quads, then the octet.
+    inline std::uint32_t parseEightDigits(const char* p) {
+        std::uint64_t v;
+        std::memcpy(&v, p, 8);
+        v -= 0x3030303030303030;
+        v = (v * 10) + (v >> 8);
+        v = (((v & 0x000000FF000000FF) * (100 + (1000000ULL << 32))) +
+             (((v >> 16) & 0x000000FF000000FF) * (1 + (10000ULL << 32)))) >> 32;
+        return static_cast<std::uint32_t>(v);
+    }
+}
+
+/**
+ * Parses a whole token as a base-10 integer of type T. Returns false (leaving out alone)
+ * for anything else: trailing junk, empty tokens, or values that do not fit in T.
+ * A leading '+' is accepted, as std::stoi did. Signed types up to 64 bits take a SWAR
+ * fast path that consumes 8 digits per step; everything else goes to std::from_chars.
+ */
+template <typename T>
+bool parseInteger(std::string_view token, T& out) {
+    static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "parseInteger needs an integer type");
+    const char* p = token.data();
+    const char* end = p + token.size();
+    if (end - p > 1 && *p == '+' && p[1] != '-') ++p;
+
+    if constexpr (std::is_signed_v<T> && sizeof(T) <= 8 && std::endian::native == std::endian::little) {
+        const char* q = p;
+        bool negative = q != end && *q == '-';
+        if (negative) ++q;
+        // Up to 18 digits always fits in 64 bits, so no overflow checks inside the loop.
+        if (q != end && end - q <= 18) {
+            std::uint64_t v = 0;
+            while (end - q >= 8 && internal::isEightDigits(q)) {
+                v = v * 100000000 + internal::parseEightDigits(q);
+                q += 8;
+            }
+            while (q != end && static_cast<unsigned char>(*q - '0') < 10) {
+                v = v * 10 + static_cast<unsigned>(*q - '0');
+                ++q;
+            }
+            if (q != end) return false;
+            constexpr std::uint64_t maxValue = static_cast<std::uint64_t>(std::numeric_limits<T>::max());
+            if (v > maxValue + (negative ? 1 : 0)) return false;
+            out = negative ? static_cast<T>(0 - v) : static_cast<T>(v);
+            return true;
+        }
+    }
+
+    T value{};
+    auto [ptr, ec] = std::from_chars(p, end, value);
+    if (ec != std::errc{} || ptr != end) return false;
+    out = value;
+    return true;
+}
+
+} // namespace utils
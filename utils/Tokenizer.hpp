@@ -0,0 +1,185 @@
+#pragma once
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define UTILS_TOKENIZER_X86 1
+#else
+#define UTILS_TOKENIZER_X86 0
+#endif
+
+namespace utils {
+
+// One token of a scanned text: text.substr(offset, length).
+struct Token {
+    std::size_t offset;
+    std::size_t length;
+};
+
+/**
+ * Delimiter: What separates tokens. Either the "C"-locale whitespace set used by
+ * `std::cin >> word` (space, \t, \n, \v, \f, \r) or a single byte such as '|'.
+ * Runs of delimiters count as one separator, so tokens are never empty.
+ */
+struct Delimiter {
+    enum class Kind { Whitespace, Byte };
+    Kind kind = Kind::Whitespace;
+    char byte = 0;
+
+    static Delimiter whitespace() { return {}; }
+    static Delimiter of(char c) { return {Kind::Byte, c}; }
+    bool matches(char c) const {
+        return kind == Kind::Whitespace ? (c == ' ' || (c >= '\t' && c <= '\r')) : c == byte;
+    }
+};
+
+enum class SimdLevel { Scalar, SSE2, AVX2 };
+
+namespace internal {
+    // Tokens are handed to the sink this many at a time.
+    inline constexpr std::size_t kTokenBatch = 256;
+
+    struct ScanState {
+        std::size_t pos = 0;      // next byte to classify
+        std::size_t start = 0;    // offset of the open token, when inToken
+        bool inToken = false;
+    };
+
+    // Scans from st.pos, writing at most cap tokens; a token still open at the end of text is left open.
+    using ScanFn = std::size_t (*)(std::string_view, Delimiter, ScanState&, Token*, std::size_t);
+
+    inline std::size_t scanScalar(std::string_view text, Delimiter d, ScanState& st, Token* out, std::size_t cap) {
+        std::size_t count = 0;
+        for (; st.pos < text.size() && count < cap; ++st.pos) {
+            bool delim = d.matches(text[st.pos]);
+            if (st.inToken && delim) {
+                out[count++] = {st.start, st.pos - st.start};
+                st.inToken = false;
+            } else if (!st.inToken && !delim) {
+                st.start = st.pos;
+                st.inToken = true;
+            }
+        }
+        return count;
+    }
+
+    /**
+     * Turns the delimiter bitmask of one block (bit i = byte base + i) into tokens.
+     * Every bit where "is token byte" flips relative to the previous byte is a token start
+     * or end, so the work is one loop iteration per boundary, not per byte.
+     */
+    template <unsigned Width>
+    inline std::size_t emitBlock(std::uint32_t delim, std::size_t base, ScanState& st, Token* out) {
+        constexpr std::uint64_t all = (std::uint64_t{1} << Width) - 1;
+        std::uint64_t word = ~std::uint64_t{delim} & all;
+        std::uint64_t edges = (word ^ ((word << 1) | (st.inToken ? 1u : 0u))) & all;
+        std::size_t count = 0;
+        while (edges) {
+            std::size_t at = base + static_cast<std::size_t>(std::countr_zero(edges));
+            if (st.inToken) out[count++] = {st.start, at - st.start};
+            else st.start = at;
+            st.inToken = !st.inToken;
+            edges &= edges - 1;
+        }
+        return count;
+    }
+
+#if UTILS_TOKENIZER_X86
+    __attribute__((target("sse2")))
+    inline std::size_t scanSse2(std::string_view text, Delimiter d, ScanState& st, Token* out, std::size_t cap) {
+        const char* p = text.data();
+        const __m128i space = _mm_set1_epi8(' ');
+        const __m128i below = _mm_set1_epi8('\t' - 1);
+        const __m128i above = _mm_set1_epi8('\r' + 1);
+        const __m128i byte = _mm_set1_epi8(d.byte);
+        const bool ws = d.kind == Delimiter::Kind::Whitespace;
+        std::size_t count = 0;
+        // A 16-byte block closes at most 8 tokens (plus one carried in).
+        while (st.pos + 16 <= text.size() && count + 16 <= cap) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + st.pos));
+            __m128i m = ws ? _mm_or_si128(_mm_cmpeq_epi8(v, space),
+                                          _mm_and_si128(_mm_cmpgt_epi8(v, below), _mm_cmplt_epi8(v, above)))
+                           : _mm_cmpeq_epi8(v, byte);
+            count += emitBlock<16>(static_cast<std::uint32_t>(_mm_movemask_epi8(m)), st.pos, st, out + count);
+            st.pos += 16;
+        }
+        if (st.pos + 16 > text.size()) count += scanScalar(text, d, st, out + count, cap - count);
+        return count;
+    }
+
+    __attribute__((target("avx2")))
+    inline std::size_t scanAvx2(std::string_view text, Delimiter d, ScanState& st, Token* out, std::size_t cap) {
+        const char* p = text.data();
+        const __m256i space = _mm256_set1_epi8(' ');
+        const __m256i below = _mm256_set1_epi8('\t' - 1);
+        const __m256i above = _mm256_set1_epi8('\r' + 1);
+        const __m256i byte = _mm256_set1_epi8(d.byte);
+        const bool ws = d.kind == Delimiter::Kind::Whitespace;
+        std::size_t count = 0;
+        while (st.pos + 32 <= text.size() && count + 32 <= cap) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + st.pos));
+            __m256i m = ws ? _mm256_or_si256(_mm256_cmpeq_epi8(v, space),
+                                             _mm256_and_si256(_mm256_cmpgt_epi8(v, below), _mm256_cmpgt_epi8(above, v)))
+                           : _mm256_cmpeq_epi8(v, byte);
+            count += emitBlock<32>(static_cast<std::uint32_t>(_mm256_movemask_epi8(m)), st.pos, st, out + count);
+            st.pos += 32;
+        }
+        if (st.pos + 32 > text.size()) count += scanSse2(text, d, st, out + count, cap - count);
+        return count;
+    }
+#endif
+
+    inline ScanFn scanFor(SimdLevel level) {
+#if UTILS_TOKENIZER_X86
+        if (level == SimdLevel::AVX2) return scanAvx2;
+        if (level == SimdLevel::SSE2) return scanSse2;
+#endif
+        (void)level;
+        return scanScalar;
+    }
+}
+
+/**
+ * Widest instruction set the running CPU supports (checked once via CPUID).
+ */
+inline SimdLevel bestSimdLevel() {
+#if UTILS_TOKENIZER_X86
+    static const SimdLevel level = __builtin_cpu_supports("avx2") ? SimdLevel::AVX2
+                                 : __builtin_cpu_supports("sse2") ? SimdLevel::SSE2
+                                 : SimdLevel::Scalar;
+    return level;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+/**
+ * Tokenize: Splits text on d and calls sink(std::span<const Token>) with batches of
+ * offset/length pairs, in order. Delimiters are classified 32 (AVX2) or 16 (SSE2) bytes
+ * at a time; the kernel is picked at runtime and falls back to a byte loop elsewhere.
+ * Pass a lower `level` to force a narrower kernel (benchmarks, testing).
+ */
+template <typename Sink>
+void tokenize(std::string_view text, Delimiter d, Sink&& sink, SimdLevel level = bestSimdLevel()) {
+    Token batch[internal::kTokenBatch];
+    internal::ScanState st;
+    internal::ScanFn scan = internal::scanFor(level);
+    while (st.pos < text.size()) {
+        std::size_t n = scan(text, d, st, batch, internal::kTokenBatch);
+        if (st.pos == text.size() && st.inToken) {
+            if (n == internal::kTokenBatch) {
+                sink(std::span<const Token>(batch, n));
+                n = 0;
+            }
+            batch[n++] = {st.start, text.size() - st.start};
+            st.inToken = false;
+        }
+        if (n) sink(std::span<const Token>(batch, n));
+    }
+}
+
+} // namespace utils
@@ -0,0 +1,73 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Tokenizer.hpp"
+
+namespace utils {
+
+/**
+ * WordStream: Reads a file in fixed-size chunks and hands out its whitespace-separated
+ * words one batch per chunk. A word cut by the end of a chunk is carried over to the
+ * front of the buffer and completed by the next read, so words are never split.
+ * Memory is one chunk buffer (grown only for a single word longer than the chunk).
+ */
+class WordStream {
+    std::ifstream file_;
+    std::vector<char> buf_;
+    std::vector<std::string_view> batch_;
+    std::size_t pendingFrom_ = 0;   // unfinished word at buf_[pendingFrom_, pendingFrom_ + pendingLen_)
+    std::size_t pendingLen_ = 0;
+    bool done_ = false;
+
+public:
+    static constexpr std::size_t kDefaultChunkBytes = std::size_t{1} << 20;
+
+    explicit WordStream(const std::string& filepath, std::size_t chunkBytes = kDefaultChunkBytes)
+        : file_(filepath, std::ios::binary), buf_(std::max<std::size_t>(chunkBytes, 64)) {
+        done_ = !file_.is_open();
+    }
+
+    bool is_open() const { return file_.is_open(); }
+
+    /**
+     * Returns the complete words of the next chunk as views into the internal buffer.
+     * The views stay valid until the next call. An empty batch means the file is exhausted.
+     */
+    std::span<const std::string_view> next() {
+        batch_.clear();
+        while (batch_.empty() && !done_) {
+            // Move the carried partial word to the front, then fill the rest of the buffer.
+            std::memmove(buf_.data(), buf_.data() + pendingFrom_, pendingLen_);
+            std::size_t carry = pendingLen_;
+            pendingFrom_ = pendingLen_ = 0;
+            if (carry == buf_.size()) buf_.resize(buf_.size() * 2);
+
+            std::size_t want = buf_.size() - carry;
+            file_.read(buf_.data() + carry, static_cast<std::streamsize>(want));
+            std::size_t got = static_cast<std::size_t>(file_.gcount());
+            bool last = got < want;   // short read: end of file
+            if (last) done_ = true;
+
+            std::string_view text(buf_.data(), carry + got);
+            tokenize(text, Delimiter::whitespace(), [&](std::span<const Token> tokens) {
+                for (const Token& t : tokens) {
+                    if (!last && t.offset + t.length == text.size()) {
+                        pendingFrom_ = t.offset;
+                        pendingLen_ = t.length;
+                    } else {
+                        batch_.emplace_back(text.data() + t.offset, t.length);
+                    }
+                }
+            });
+        }
+        return batch_;
+    }
+};
+
+} // namespace utils